@@ -32,6 +32,18 @@ $TM_INTERVAL   3600.0000    0.100000    0.100000
 
 $TM_WEIGHT   0.50   0.50   0.50
 
+# --------------------------------------------------------------------------------------------------
+# ADAPTIVE SUB STEPS (maxCu, minInterval, targetIter)  (optional)
+
+#    maxCu       : target Courant number of the sub steps (0: no limit)
+#    minInterval : minimum length of sub steps [s]
+#    targetIter  : target number of Newton iterations per sub step (0: no limit)
+
+#    The time interval is divided into sub steps; sub steps with failed Newton iteration
+#    or diverged solver are repeated with reduced length. The time steps are gained exactly.
+
+#$TM_ADAPT   10.0   1.0   4
+
 # --------------------------------------------------------------------------------------------------
 # OUTPUT FOR TIME STEPS
 
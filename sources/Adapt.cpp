@@ -0,0 +1,241 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class PROJECT
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Defs.h"
+#include "Report.h"
+#include "Memory.h"
+#include "Node.h"
+#include "Grid.h"
+#include "Model.h"
+
+#include "Project.h"
+
+
+// -------------------------------------------------------------------------------------------------
+// Adaptive sub steps within the time step [prevTime, nextTime]. The sub steps are chosen
+// from the target Courant number, the number of Newton iterations of the last unsteady
+// flow cycle and the convergence of the solver. Since the sub steps always end on
+// nextTime, output and boundary set times are gained exactly.
+// -------------------------------------------------------------------------------------------------
+
+#define kAdaptGrow      2.0         // maximum growth of time increment per sub step
+#define kAdaptShrink    0.5         // reduction of time increment on rejected sub step
+#define kAdaptReject    1.5         // rejection, if Cu > kAdaptReject * adaptCu
+#define kAdaptEps       1.0e-6
+
+
+// ---------------------------------------------------------------------------------------
+// begin of a sub step: incTime is the remaining time up to nextTime on entry. Divide it
+// into sub steps of length adaptInc and save the state for a possible rejection.
+
+void PROJECT::AdaptStart()
+{
+  MODEL* model = M2D;
+  GRID*  rg    = model->region;
+  int    np    = rg->Getnp();
+
+  double rest  = timeint.incTime.Getsec();
+
+  if( timeint.adaptInc <= 0.0 )  timeint.adaptInc = timeint.deltaTime.Getsec();
+
+  if( rest > timeint.adaptInc * (1.0 + kAdaptEps) )
+  {
+    int n = (int) ceil( rest / timeint.adaptInc - kAdaptEps );
+    timeint.incTime.Setsec( rest / n );
+  }
+
+  // save bottom elevations (bed evolution is not reset with vo) ------------------------
+  if( !adaptZ )
+  {
+    adaptZ = new double[3*np];
+
+    if( !adaptZ )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - PROJECT::AdaptStart(1)" );
+  }
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+
+    adaptZ[3*n]   = nd->z;
+    adaptZ[3*n+1] = nd->zor;
+    adaptZ[3*n+2] = nd->dz;
+  }
+
+  // error levels of the sub step are collected separately -----------------------------
+  adaptErr   |= errLevel;
+  errLevel    = kErr_no_error;
+
+  iterCountNR = 0;
+
+  REPORT::rpt.Message( 2, "\n%-25s%s %.3lf sec\n",
+                          " (PROJECT::AdaptStart)", "time increment of sub step:",
+                          timeint.incTime.Getsec() );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// check the sub step after each cycle. A sub step with a failed Newton iteration, a
+// diverged solver or a Courant number much larger than adaptCu is reset to the values
+// at the begin of the sub step (vo) and repeated with a reduced time increment.
+// The function returns true, if the sub step has been rejected.
+
+int PROJECT::AdaptReject()
+{
+  MODEL* model = M2D;
+  GRID*  rg    = model->region;
+  int    np    = rg->Getnp();
+
+  // no unsteady flow cycle computed in this sub step ----------------------------------
+  if( subdom.Mpi_max(iterCountNR) <= 0 )  return false;
+
+  double dt      = timeint.incTime.Getsec();
+  double minTime = timeint.adaptMinTime;
+
+  if( minTime <= 0.0 )  minTime = timeint.deltaTime.Getsec() / 100.0;
+
+  int    failed  = subdom.Mpi_max( errLevel & (kErr_interrupt | kErr_no_conv_nr | kErr_no_conv_cg) );
+  double factor  = kAdaptShrink;
+
+  if( !failed  &&  timeint.adaptCu > 0.0 )
+  {
+    double cu[2], pe[2];
+
+    rg->MaxCuPe( dt, vk, cu, pe );
+
+    double maxCu = subdom.Mpi_max( cu[0] > cu[1] ? cu[0] : cu[1] );
+
+    if( maxCu > kAdaptReject * timeint.adaptCu )
+    {
+      failed = true;
+      factor = timeint.adaptCu / maxCu;
+    }
+  }
+
+  // accept the sub step, if it can not be reduced any more ----------------------------
+  if( !failed  ||  dt <= minTime * (1.0 + kAdaptEps) )
+  {
+    if( errLevel & kErr_interrupt )  errLevel |= adaptErr;
+    return false;
+  }
+
+  double inc = factor * dt;
+  if( inc < minTime )  inc = minTime;
+
+  REPORT::rpt.Message( 1, "\n%-25s%s %.3lf sec %s %.3lf sec\n",
+                          " (PROJECT::AdaptReject)", "sub step rejected:", dt,
+                          "repeated with", inc );
+
+  // reset to values at begin of the sub step ------------------------------------------
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+
+    nd->v.U    = nd->vo.U;
+    nd->v.V    = nd->vo.V;
+    nd->v.S    = nd->vo.S;
+
+    nd->v.K    = nd->vo.K;
+    nd->v.D    = nd->vo.D;
+
+    nd->v.C    = nd->vo.C;
+
+    nd->v.dUdt = nd->vo.dUdt;
+    nd->v.dVdt = nd->vo.dVdt;
+    nd->v.dSdt = nd->vo.dSdt;
+
+    nd->z      = adaptZ[3*n];
+    nd->zor    = adaptZ[3*n+1];
+    nd->dz     = adaptZ[3*n+2];
+  }
+
+  timeint.adaptInc = inc;
+  timeint.incTime.Setsec( inc );
+
+  errLevel    = kErr_no_error;
+  iterCountNR = 0;
+
+  return true;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// accepted sub step: time increment for the next sub step from the Courant number and
+// the number of Newton iterations
+
+void PROJECT::AdaptNext()
+{
+  MODEL* model = M2D;
+  GRID*  rg    = model->region;
+
+  errLevel |= adaptErr;
+  adaptErr  = errLevel;
+
+  // keep the time increment, if no unsteady flow cycle was computed -------------------
+  int nrIt = subdom.Mpi_max( iterCountNR );
+
+  if( nrIt <= 0 )  return;
+
+  double dt     = timeint.incTime.Getsec();
+  double factor = kAdaptGrow;
+
+  if( timeint.adaptCu > 0.0 )
+  {
+    double cu[2], pe[2];
+
+    rg->MaxCuPe( dt, vk, cu, pe );
+
+    double maxCu = subdom.Mpi_max( cu[0] > cu[1] ? cu[0] : cu[1] );
+
+    if( maxCu > 0.0  &&  timeint.adaptCu / maxCu < factor )  factor = timeint.adaptCu / maxCu;
+  }
+
+  if( timeint.adaptIter > 0  &&  nrIt > 0 )
+  {
+    double f = (double) timeint.adaptIter / nrIt;
+    if( f < factor )  factor = f;
+  }
+
+  if( factor < kAdaptShrink*kAdaptShrink )  factor = kAdaptShrink*kAdaptShrink;
+
+  double inc     = factor * dt;
+  double maxTime = timeint.deltaTime.Getsec();
+  double minTime = timeint.adaptMinTime;
+
+  if( minTime <= 0.0 )  minTime = maxTime / 100.0;
+
+  if( inc > maxTime )  inc = maxTime;
+  if( inc < minTime )  inc = minTime;
+
+  timeint.adaptInc = inc;
+}
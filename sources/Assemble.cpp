@@ -196,16 +196,35 @@ void CRSMAT::AssembleEqs_im( EQS*     eqs,
                              double*  vector,
                              MODEL*   model,
                              PROJECT* project )
+{
+  Assemble( eqs, vector, model, project, true, false );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Assemble() evaluates the element coefficients in a single pass over all elements: the
+// force vectors are assembled into vector (residual of the Newton iteration), with matrix
+// also the element matrices into m_A; with aux the element force vectors are passed to
+// EQS::Auxiliary() without a further pass over the elements
+// ---------------------------------------------------------------------------------------
+
+void CRSMAT::Assemble( EQS*     eqs,
+                       double*  vector,
+                       MODEL*   model,
+                       PROJECT* project,
+                       int      matrix,
+                       int      aux )
 {
   int neq  = eqs->neq;
   int dfcn = eqs->dfcn;
-  int dfel = eqs->dfel;
 
   double*  force  = eqs->force;
-  double** estifm = eqs->estifm;
+  double** estifm = NULL;
+
+  if( matrix )  estifm = eqs->estifm;
 
   REPORT::rpt.Message( 3, "\n (CRSMAT::Assemble...)   %s (%d elements)\n",
-                          "assembling eqs", model->ne );
+                          estifm? "assembling eqs" : "assembling force", model->ne );
 
 
   // initializations ---------------------------------------------------------------------
@@ -215,82 +234,137 @@ void CRSMAT::AssembleEqs_im( EQS*     eqs,
 
   // -------------------------------------------------------------------------------------
   // assemble elements
+  // Elements for which eqs->Batched() is true are collected in batches of the same
+  // shape, whose coefficients are computed at once (see InsertBatch). Batches are
+  // inserted in the order of elements, so that the summation into the matrix is the
+  // same as with one element at a time. Force vectors only are computed element by
+  // element; so are the coefficients for Jacobian-free iterations (EQS::jfnk), which
+  // need the same residual as the force vectors of EQS::MulVecFD().
+
+  int   batched = estifm  &&  !eqs->jfnk;
+
+  int   nb = 0;
+  ELEM* batch[EQS::kBatch];
 
   for( int e=0; e<model->ne; e++ )
   {
     ELEM* el = model->elem[e];
 
+    if( batched  &&  eqs->Batched(el) )
+    {
+      if( nb > 0  &&  el->GetQShape() != batch[0]->GetQShape() )
+      {
+        InsertBatch( eqs, nb, batch, project, vector, aux );
+        nb = 0;
+      }
+
+      batch[nb++] = el;
+
+      if( nb == EQS::kBatch )
+      {
+        InsertBatch( eqs, nb, batch, project, vector, aux );
+        nb = 0;
+      }
+
+      continue;
+    }
+
 
     // compute element coefficients ------------------------------------------------------
 
     if( !eqs->Coefs(el, project, estifm, force) )  continue;
 
-    int nnd = el->Getnnd();
+    if( nb > 0 )
+    {
+      InsertBatch( eqs, nb, batch, project, vector, aux );
+      nb = 0;
+    }
 
+    if( estifm )  InsertEqs( eqs, el, estifm, force, vector );
+    else          InsertForce( eqs, el, force, vector );
 
-    // insert element stiffness matrix (estifm) and (force) ------------------------------
+    if( aux )  eqs->Auxiliary( el, project, force );
+  }
 
-    for( int i=0; i<nnd; i++ )               // loop on nodes
-    {
-      for( int j=0; j<dfcn; j++ )            // loop on node-equations
-      {
-        int rind = i + j*nnd;
-        int row  = eqs->GetEqno( el->nd[i], j );
+  if( nb > 0 )  InsertBatch( eqs, nb, batch, project, vector, aux );
 
-        if( row >= 0 )
-        {
-          REALPR* APtr      = m_A[row];
-          double* estifmPtr = estifm[rind];
+  if( !estifm )  return;
 
-          vector[row] += force[rind];
+  // identity rows of equations masked with stable equation numbers (see EQS::stable)
 
-          for( int k=0; k<nnd; k++ )         // loop on nodes
-          {
-            for( int l=0; l<dfcn; l++ )      // loop on node-equations
-            {
-              int cind = k + l*nnd;
-              int col  = eqs->GetEqno( el->nd[k], l );
+  for( int i=0; i<eqs->nmask; i++ )  m_A[eqs->mask[i]][0] = 1.0;
 
-              if( col >= 0 )
-              {
-                for( int m=0; m<m_width[row]; m++ )
-                {
-                  if( col == m_index[row][m] )
-                  {
-                    APtr[m] += (REALPR) estifmPtr[cind];
-                    break;
-                  }
-                }
-              }
-            }
-          }
+  REPORT::rpt.Message( 3, "\n\n%-25s%s\n\n%15s %1s  %8s  %14s  %14s\n\n",
+                          " (CRSMAT::Assemble...)", "Newton-Raphson-residuum / force vector ...",
+                          " ", " ", "  node", "   average", "   maximum" );
 
-          for( int l=0; l<dfel; l++ )        // loop on element-equations
-          {
-            int cind = dfcn*nnd + l;
-            int col  = eqs->GetEqno( el, l );
+  for( int e=0; e<dfcn; e++ )
+  {
+    int    no  = 0;
+    double ave = 0.0;
+    double max = 0.0;
 
-            if( col >= 0 )
-            {
-              for( int m=0; m<m_width[row]; m++ )
-              {
-                if( col == m_index[row][m] )
-                {
-                  APtr[m] += (REALPR) estifmPtr[cind];
-                  break;
-                }
-              }
-            }
-          }
+    for( int n=0; n<model->np; n++ )
+    {
+      NODE* nd = model->node[n];
+      int eqno = eqs->GetEqno( nd, e );
+
+      if( eqno >= 0 )
+      {
+        double vec = vector[eqno];
+
+        ave += vec;
+        if( fabs(vec) > fabs(max) )
+        {
+          max = vec;
+          no  = nd->Getname();
         }
       }
     }
 
+    int tot = neq - eqs->nmask;
 
-    for( int j=0; j<dfel; j++ )              // loop on element-equations
+    //////////////////////////////////////////////////////////////////////////////////////
+#   ifdef _MPI_
+    max = project->subdom.Mpi_max( max );
+    tot = project->subdom.Mpi_sum( eqs->neq_up );
+    ave = project->subdom.Mpi_sum( ave );
+#   endif
+    //////////////////////////////////////////////////////////////////////////////////////
+
+    if( tot )  ave /= tot;
+
+    REPORT::rpt.Message( 3, " %15s %1d  %8d  %14.5le  %14.5le\n", " ", e+1, no, ave, max );
+  }
+
+  REPORT::rpt.Message( 3, "\n" );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// insert element stiffness matrix (estifm) and force vector (force) of element el
+// ---------------------------------------------------------------------------------------
+
+void CRSMAT::InsertEqs( EQS*     eqs,
+                        ELEM*    el,
+                        double** estifm,
+                        double*  force,
+                        double*  vector )
+{
+  int dfcn = eqs->dfcn;
+  int dfel = eqs->dfel;
+
+  int nnd = el->Getnnd();
+
+
+  // insert element stiffness matrix (estifm) and (force) ------------------------------
+
+  for( int i=0; i<nnd; i++ )               // loop on nodes
+  {
+    for( int j=0; j<dfcn; j++ )            // loop on node-equations
     {
-      int rind = dfcn*nnd + j;
-      int row  = eqs->GetEqno( el, j );
+      int rind = i + j*nnd;
+      int row  = eqs->GetEqno( el->nd[i], j );
 
       if( row >= 0 )
       {
@@ -299,9 +373,9 @@ void CRSMAT::AssembleEqs_im( EQS*     eqs,
 
         vector[row] += force[rind];
 
-        for( int k=0; k<nnd; k++ )           // loop on nodes
+        for( int k=0; k<nnd; k++ )         // loop on nodes
         {
-          for( int l=0; l<dfcn; l++ )        // loop on node-equations
+          for( int l=0; l<dfcn; l++ )      // loop on node-equations
           {
             int cind = k + l*nnd;
             int col  = eqs->GetEqno( el->nd[k], l );
@@ -320,8 +394,7 @@ void CRSMAT::AssembleEqs_im( EQS*     eqs,
           }
         }
 
-
-        for( int l=0; l<dfel; l++ )          // loop on element-equations
+        for( int l=0; l<dfel; l++ )        // loop on element-equations
         {
           int cind = dfcn*nnd + l;
           int col  = eqs->GetEqno( el, l );
@@ -343,50 +416,81 @@ void CRSMAT::AssembleEqs_im( EQS*     eqs,
   }
 
 
-  REPORT::rpt.Message( 3, "\n\n%-25s%s\n\n%15s %1s  %8s  %14s  %14s\n\n",
-                          " (CRSMAT::Assemble...)", "Newton-Raphson-residuum / force vector ...",
-                          " ", " ", "  node", "   average", "   maximum" );
-
-  for( int e=0; e<dfcn; e++ )
+  for( int j=0; j<dfel; j++ )              // loop on element-equations
   {
-    int    no  = 0;
-    double ave = 0.0;
-    double max = 0.0;
+    int rind = dfcn*nnd + j;
+    int row  = eqs->GetEqno( el, j );
 
-    for( int n=0; n<model->np; n++ )
+    if( row >= 0 )
     {
-      NODE* nd = model->node[n];
-      int eqno = eqs->GetEqno( nd, e );
+      REALPR* APtr      = m_A[row];
+      double* estifmPtr = estifm[rind];
 
-      if( eqno >= 0 )
+      vector[row] += force[rind];
+
+      for( int k=0; k<nnd; k++ )           // loop on nodes
       {
-        double vec = vector[eqno];
+        for( int l=0; l<dfcn; l++ )        // loop on node-equations
+        {
+          int cind = k + l*nnd;
+          int col  = eqs->GetEqno( el->nd[k], l );
 
-        ave += vec;
-        if( fabs(vec) > fabs(max) )
+          if( col >= 0 )
+          {
+            for( int m=0; m<m_width[row]; m++ )
+            {
+              if( col == m_index[row][m] )
+              {
+                APtr[m] += (REALPR) estifmPtr[cind];
+                break;
+              }
+            }
+          }
+        }
+      }
+
+
+      for( int l=0; l<dfel; l++ )          // loop on element-equations
+      {
+        int cind = dfcn*nnd + l;
+        int col  = eqs->GetEqno( el, l );
+
+        if( col >= 0 )
         {
-          max = vec;
-          no  = nd->Getname();
+          for( int m=0; m<m_width[row]; m++ )
+          {
+            if( col == m_index[row][m] )
+            {
+              APtr[m] += (REALPR) estifmPtr[cind];
+              break;
+            }
+          }
         }
       }
     }
+  }
+}
 
-    int tot = neq;
 
-    //////////////////////////////////////////////////////////////////////////////////////
-#   ifdef _MPI_
-    max = project->subdom.Mpi_max( max );
-    tot = project->subdom.Mpi_sum( eqs->neq_up );
-    ave = project->subdom.Mpi_sum( ave );
-#   endif
-    //////////////////////////////////////////////////////////////////////////////////////
+// ---------------------------------------------------------------------------------------
+// compute the coefficients of a batch of nb elements and insert them in turn
+// ---------------------------------------------------------------------------------------
 
-    if( tot )  ave /= tot;
+void CRSMAT::InsertBatch( EQS*     eqs,
+                          int      nb,
+                          ELEM**   batch,
+                          PROJECT* project,
+                          double*  vector,
+                          int      aux )
+{
+  eqs->CoefsBatch( nb, batch, project, eqs->estifmBatch, eqs->forceBatch );
 
-    REPORT::rpt.Message( 3, " %15s %1d  %8d  %14.5le  %14.5le\n", " ", e+1, no, ave, max );
-  }
+  for( int b=0; b<nb; b++ )
+  {
+    InsertEqs( eqs, batch[b], eqs->estifmBatch[b], eqs->forceBatch[b], vector );
 
-  REPORT::rpt.Message( 3, "\n" );
+    if( aux )  eqs->Auxiliary( batch[b], project, eqs->forceBatch[b] );
+  }
 }
 
 
@@ -395,68 +499,39 @@ void CRSMAT::AssembleForce( EQS*     eqs,
                             MODEL*   model,
                             PROJECT* project )
 {
-  int i, j;
-
-  int neq  = eqs->neq;
-  int dfcn = eqs->dfcn;
-  int dfel = eqs->dfel;
-
-  double* force = eqs->force;
-
-  REPORT::rpt.Message( 3, "\n (CRSMAT::Assemble...)   %s (%d elements)\n",
-                          "assembling force", model->ne );
+  Assemble( eqs, vector, model, project, false, false );
+}
 
 
-  // initializations ---------------------------------------------------------------------
+// ---------------------------------------------------------------------------------------
+// insert the force vector (force) of element el
+// ---------------------------------------------------------------------------------------
 
-  for( i=0; i<neq; i++ ) vector[i] = 0.0;
+void CRSMAT::InsertForce( EQS*     eqs,
+                          ELEM*    el,
+                          double*  force,
+                          double*  vector )
+{
+  int dfcn = eqs->dfcn;
+  int dfel = eqs->dfel;
 
+  int nnd = el->Getnnd();
 
-  // -------------------------------------------------------------------------------------
-  // assemble elements
-
-  for( int e=0; e<model->ne; e++ )
+  for( int i=0; i<nnd; i++ )
   {
-    ELEM* el = model->elem[e];
-
-    int row;
-    int rind;
-
-    int nnd = el->Getnnd();
-
-
-    // compute element coefficients ------------------------------------------------------
-
-    if( !eqs->Coefs(el, project, (double **) 0, force) )  continue;
-
-
-    // insert force vector ---------------------------------------------------------------
-
-    for( i=0; i<nnd; i++ )
+    for( int j=0; j<dfcn; j++ )
     {
-      for( j=0; j<dfcn; j++ )
-      {
-        rind = i + j*nnd;
-        row  = eqs->GetEqno( el->nd[i], j );
+      int row = eqs->GetEqno( el->nd[i], j );
 
-        if( row >= 0 )
-        {
-          vector[row] += force[rind];
-        }
-      }
+      if( row >= 0 )  vector[row] += force[i + j*nnd];
     }
+  }
 
+  for( int j=0; j<dfel; j++ )
+  {
+    int row = eqs->GetEqno( el, j );
 
-    for( j=0; j<dfel; j++ )
-    {
-      rind = dfcn*nnd + j;
-      row  = eqs->GetEqno( el, j );
-
-      if( row >= 0 )
-      {
-        vector[row] += force[rind];
-      }
-    }
+    if( row >= 0 )  vector[row] += force[dfcn*nnd + j];
   }
 }
 
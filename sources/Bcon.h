@@ -60,6 +60,11 @@
 // 12.12.2013     sc     Rismo-Version 4.05.17: new boundary conditions for nodes
 //                       TARGET_S and TARGET_ST to control the outlet water elevation
 //                       from a different node
+// 19.10.2026     ag     BCONSET::UpdateBcon(): state dependent part of boundary conditions
+// 19.10.2026     ag     BCONLINE: cached elements and nodes of control lines, search of
+//                       time intervals and rating curves, index of bcon[] by node
+// 19.10.2026     ag     BCONLINE: discharge of inlets once per time level, distribution
+//                       updated in iterations (UpdateInlet)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,6 +76,7 @@
 
 class NODE;
 class ELEM;
+class GRID;
 class MODEL;
 class PROJECT;
 class SUBDOM;
@@ -230,13 +236,48 @@ class BCONLINE : public BCON
     double          dw;       // wall distance in log law
     double          kw;       // roughness height in log law
 
+                              // --- control line, set up by Prepare()
+    int             nlineCt;  // number of elements in the control grid
+    int             nlineEl;  // elements of the control line
+    ELEM**          lineEl;
+    int             nlineNd;  // nodes of the control line (ordered by node number)
+    NODE**          lineNd;
+    double*         lineWgt;  // weights of Gauss points for discharge integration
+    BCVAL**         lineVal;  // boundary values of lineNd[] set by a discharge inlet
+    SUBDOM*         subdom;   // subdomains to sum up the discharge (MPI)
+
+                              // --- discharge inlet, set up by Inlet()
+    int             qtSet;    // Qspec and Sspec determined for time qtTime
+    double          qtTime;
+    double          Qspec;    // specified discharge
+    double          Sspec;    // specified water surface
+    double          Qratio;   // ratio of Qspec to the integrated discharge profile
+
+    int             sortx;    // time series x[] strictly ascending
+    int             sortU;    // discharges U[] of rating curve ascending
+    int             cursor;   // interval of the last time search
+
+    static int*     bcIndex;  // index of the boundary condition of node no in bcon[]
+    static int      nbcIndex; // size of array bcIndex
+    static int      bcIndexed;// number of entries in bcon[] registered in bcIndex
+
   public:
     BCONLINE();
     ~BCONLINE();
 
     int   GenBcon( MODEL *model, TIME *at, int b, BCON *bcon, double *preQ );
     int   FindInterval( double x, double y, int n, double *xar, double *yar, double *l );
+    int   FindTime( double t, double *l );
     BCON* FindBcon( int no, int b, BCON *bcon );
+    void  Prepare( MODEL *model );
+    void  SortNodes();
+
+    static void ResetIndex( int np );
+    void   Discharge( TIME *at );
+    double Specific( NODE *nd );
+    double Profile();
+    void   CheckInlet();
+    void   UpdateInlet();
     int   Inlet( MODEL *model, TIME *at, int b, BCON *bcon );
     int   Outlet( MODEL *model, TIME *at, int b, BCON *bcon, double *preQ );
     int   Further( MODEL *model, TIME *at, int b, BCON *bcon, long *ki );
@@ -286,6 +327,9 @@ class BCONSET
     int             ngct;         // number of gauge controlled nodes on outlet
     BCVAL::GAUGECT *gct;          // list of gauge controlled nodes on outlet
 
+    int       stateDep;           // boundary setup depends on the flow state:
+                                  // S(Q)-outlets, gauge control
+
   public:
     BCONSET();
     ~BCONSET();
@@ -293,6 +337,7 @@ class BCONSET
     // Bconset.cpp -----------------------------------------------------------------------
     BCON*  GetBcon( int );
     void   InitBcon( PROJECT* project, TIME* actualTime, double* =NULL );
+    void   UpdateBcon( PROJECT* project );
     double Loglaw( double Us, double dw, double kw, double ka, double vk, double g );
 };
 
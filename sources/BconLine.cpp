@@ -44,14 +44,195 @@
 #include "Bcon.h"
 
 
+int* BCONLINE::bcIndex   = NULL;
+int  BCONLINE::nbcIndex  = 0;
+int  BCONLINE::bcIndexed = 0;
+
+
 BCONLINE::BCONLINE() : BCON()
 {
-  ndat = 0;
+  ndat    = 0;
+
+  nlineCt = 0;
+  nlineEl = 0;
+  lineEl  = NULL;
+  nlineNd = 0;
+  lineNd  = NULL;
+  lineWgt = NULL;
+  lineVal = NULL;
+  subdom  = NULL;
+
+  qtSet   = false;
+  qtTime  = 0.0;
+  Qspec   = 0.0;
+  Sspec   = 0.0;
+  Qratio  = 0.0;
+
+  sortx   = false;
+  sortU   = false;
+  cursor  = 0;
 }
 
 
 BCONLINE::~BCONLINE()
 {
+  if( lineEl )   delete[] lineEl;
+  if( lineNd )   delete[] lineNd;
+  if( lineWgt )  delete[] lineWgt;
+  if( lineVal )  delete[] lineVal;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Set up the elements and nodes of the control line, the weights of Gauss points and
+// the order of time series and rating curve. This is done once, since the control grid
+// does not change.
+
+static int CompareNodes( const void* n1, const void* n2 )
+{
+  int no1 = (*(NODE**) n1)->Getno();
+  int no2 = (*(NODE**) n2)->Getno();
+
+  return no1 - no2;
+}
+
+
+void BCONLINE::Prepare( MODEL* model )
+{
+  GRID* ct = model->control;
+
+  subdom = model->subdom;
+
+  if( lineEl  &&  nlineCt == ct->Getne() )  return;
+
+  if( lineEl )   delete[] lineEl;
+  if( lineNd )   delete[] lineNd;
+  if( lineWgt )  delete[] lineWgt;
+  if( lineVal )  delete[] lineVal;
+
+  nlineCt = ct->Getne();
+
+  // elements of the line ----------------------------------------------------------------
+  nlineEl = 0;
+
+  for( int c=0; c<ct->Getne(); c++ )
+  {
+    if( ct->Getelem(c)->type == no )  nlineEl++;
+  }
+
+  lineEl = new ELEM* [nlineEl+1];
+
+  int ngp = 0;
+  int nnd = 0;
+
+  nlineEl = 0;
+
+  for( int c=0; c<ct->Getne(); c++ )
+  {
+    ELEM* el = ct->Getelem(c);
+
+    if( el->type != no )  continue;
+
+    lineEl[nlineEl++] = el;
+
+    ngp += el->GetQShape()->ngp;
+    nnd += el->Getnnd();
+
+    for( int i=0; i<el->Getnnd(); i++ )  el->nd[i]->mark = false;
+  }
+
+  // nodes of the line, weights of Gauss points -----------------------------------------
+  lineNd  = new NODE* [nnd+1];
+  lineWgt = new double [ngp+1];
+  lineVal = new BCVAL* [nnd+1];
+
+  if( !lineEl  ||  !lineNd  ||  !lineWgt  ||  !lineVal )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - BCONLINE::Prepare(1)" );
+
+  nlineNd = 0;
+  ngp     = 0;
+
+  for( int c=0; c<nlineEl; c++ )
+  {
+    ELEM*  el     = lineEl[c];
+    SHAPE* qShape = el->GetQShape();
+
+    for( int i=0; i<el->Getnnd(); i++ )
+    {
+      NODE* nd = el->nd[i];
+
+      if( !nd->mark )
+      {
+        nd->mark = true;
+        lineNd[nlineNd++] = nd;
+      }
+    }
+
+    NODE** node = el->nd;
+
+    for( int g=0; g<qShape->ngp; g++ )
+    {
+      double* dN = qShape->dfdx[g];
+
+      double dx = dN[0]*node[0]->x + dN[1]*node[1]->x + dN[2]*node[2]->x;
+      double dy = dN[0]*node[0]->y + dN[1]*node[1]->y + dN[2]*node[2]->y;
+
+      lineWgt[ngp++] = qShape->weight[g] * sqrt(dx*dx + dy*dy);
+    }
+  }
+
+  SortNodes();
+
+  // order of time series and rating curve ----------------------------------------------
+  sortx = ( ndat > 1 );
+  sortU = ( ndat > 1 );
+
+  for( int i=0; i<ndat-1; i++ )
+  {
+    if( !(x[i+1] - x[i] > kEpsilon) )  sortx = false;
+    if( U[i+1] < U[i] )                sortU = false;
+  }
+
+  cursor = 0;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// order the nodes of the control line by node numbers, which may have changed
+
+void BCONLINE::SortNodes()
+{
+  for( int i=1; i<nlineNd; i++ )
+  {
+    if( lineNd[i]->Getno() < lineNd[i-1]->Getno() )
+    {
+      qsort( lineNd, nlineNd, sizeof(NODE*), CompareNodes );
+      break;
+    }
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// The boundary condition of a node in bcon[] is found with the index bcIndex, which is
+// reset by BCONSET::InitBcon() for each new list bcon[].
+
+void BCONLINE::ResetIndex( int np )
+{
+  if( np > nbcIndex )
+  {
+    if( bcIndex )  delete[] bcIndex;
+
+    nbcIndex = np;
+    bcIndex  = new int [nbcIndex];
+
+    if( !bcIndex )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - BCONLINE::ResetIndex(1)" );
+  }
+
+  for( int i=0; i<nbcIndex; i++ )  bcIndex[i] = -1;
+
+  bcIndexed = 0;
 }
 
 
@@ -73,6 +254,8 @@ int BCONLINE::GenBcon( MODEL  *model,
   REPORT::rpt.Output( text, 3 );
 
 
+  Prepare( model );
+
   // initialize node flags ---------------------------------------------------------------
 
   for( int i=0; i<rg->Getnp(); i++ )
@@ -231,8 +414,67 @@ int BCONLINE::FindInterval( double  x,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// FindTime() returns the same interval as FindInterval( t, 0.0, ndat, x, NULL, l ):
+// the first one, which contains t within a tolerance. For strictly ascending times the
+// interval of the last call is tried first, otherwise a binary search is done.
+
+int BCONLINE::FindTime( double t, double* l )
+{
+  if( !sortx )  return FindInterval( t, 0.0, ndat, x, NULL, l );
+
+  int j = cursor;
+
+  if( j < 0  ||  j >= ndat-1  ||  t < x[j]  ||  t > x[j+1] )
+  {
+    int lo = 0;
+    int hi = ndat-1;
+
+    while( hi - lo > 1 )
+    {
+      int mid = (lo + hi) / 2;
+
+      if( x[mid] <= t )  lo = mid;
+      else               hi = mid;
+    }
+
+    j = lo;
+  }
+
+  // step back to the first interval containing t
+  while( j > 0  &&  (t - x[j-1]) / (x[j] - x[j-1]) < 1.001 )  j--;
+
+  double lx = (t - x[j]) / (x[j+1] - x[j]);
+
+  if( lx > -0.001  &&  lx < 1.001 )
+  {
+    cursor = j;
+    *l     = lx;
+    return j;
+  }
+
+  return -1;
+}
+
+
 BCON* BCONLINE::FindBcon( int no, int b, BCON* bcon )
 {
+  if( bcIndex  &&  no < nbcIndex )
+  {
+    // register entries appended to bcon[] since the last call
+    for( ; bcIndexed<b; bcIndexed++ )
+    {
+      int n = bcon[bcIndexed].no;
+      if( n >= 0  &&  n < nbcIndex  &&  bcIndex[n] < 0 )  bcIndex[n] = bcIndexed;
+    }
+
+    int i = bcIndex[no];
+
+    if( i >= 0  &&  i < b )  return &bcon[i];
+
+    return NULL;
+  }
+
   BCON* bc = NULL;
 
   for( int i=0; i<b; i++ )
@@ -248,151 +490,186 @@ BCON* BCONLINE::FindBcon( int no, int b, BCON* bcon )
 }
 
 
-//////////////////////////////////////////////////////////////////////////////////////////
+// ---------------------------------------------------------------------------------------
+// Discharge inlets (kQInlet): the specified discharge Qspec and water elevation Sspec
+// depend on time only and are determined once for each time level by Discharge(). The
+// discharge is distributed to the nodes of the line with the profile q = h^(3/2)/sqrt(cf),
+// which depends on the flow state by friction; UpdateInlet() redistributes Qspec in the
+// iterations of a time step to the boundary values lineVal[] set by Inlet().
 
-int BCONLINE::Inlet( MODEL* model, TIME* actualTime, int b, BCON* bcon )
+void BCONLINE::Discharge( TIME* actualTime )
 {
-  int  firstMiss = true;
-  char text[120];
+  double t = actualTime->Getsec();
 
-  GRID* ct = model->control;
-  GRID* rg = model->region;
+  if( qtSet  &&  t == qtTime )  return;
 
-  ////////////////////////////////////////////////////////////////////////////////////////
-  // BCON::kQInlet
-  ////////////////////////////////////////////////////////////////////////////////////////
+  Qspec = U[0];
+  Sspec = S[0];
 
-  if( isFS(kind, BCON::kQInlet) )
+  if( isFS(kind, BCON::kQTInlet) )
   {
-    double Qspec  = U[0];
-    double Sspec  = S[0];
+    double L;
 
-    // determine discharge for actual time -----------------------------------------------
-    if( isFS(kind, BCON::kQTInlet) )
+    int j = FindTime( t, &L );
+
+    if( j >= 0 )
     {
-      double L;
+      Qspec = U[j]  +  L * (U[j+1] - U[j]);
+      Sspec = S[j]  +  L * (S[j+1] - S[j]);
+    }
+  }
 
-      int j = FindInterval( actualTime->Getsec(), 0.0, ndat, x, NULL, &L );
+  qtSet  = true;
+  qtTime = t;
+}
 
-      if( j >= 0 )
-      {
-        Qspec = U[j]  +  L * (U[j+1] - U[j]);
-        Sspec = S[j]  +  L * (S[j+1] - S[j]);
-      }
-    }
 
-    // compute a specific discharge profile ----------------------------------------------
-    double q[3];
-    NODE*  node[3];
+double BCONLINE::Specific( NODE* nd )
+{
+  double q = 0.0;
 
-    double Q = 0.0;
+  if( isFS(nd->flag, NODE::kDry) || isFS(nd->flag, NODE::kMarsh) )
+  {
+    q = 0.0;
+  }
+  else
+  {
+    double h = Sspec - nd->z;
+    if( h > 0.0 )  q = sqrt( h*h*h );
+    else           q = 0.0;
+
+    double cf = nd->cf;
+    if( cf > 0.0 )  q /= sqrt(cf);
+  }
 
-    for( int c=0; c<ct->Getne(); c++ )
+  return q;
+}
+
+
+double BCONLINE::Profile()
+{
+  double q[3];
+
+  double Q = 0.0;
+
+  double* wgt = lineWgt;                     // weights of Gauss points (Prepare)
+
+  for( int c=0; c<nlineEl; c++ )
+  {
+    ELEM* el = lineEl[c];
+
+    SHAPE* qShape = el->GetQShape();
+
+    // the specific discharge profile at corner nodes and midside node
+    for( int i=0; i<qShape->nnd; i++ )  q[i] = Specific( el->nd[i] );
+
+    // integrate the specific discharge profile
+    for( int g=0; g<qShape->ngp; g++ )       // loop on GAUSS points
     {
-      ELEM* el = ct->Getelem(c);
+      double* N  = qShape->f[g];             // quadratic shape
 
-      if( el->type != no )  continue;
+      double qg = N[0]*q[0] + N[1]*q[1] + N[2]*q[2];
 
-      SHAPE* qShape = el->GetQShape();
+      Q += wgt[g] * qg;
+    }
 
-      int nnd = qShape->nnd;
+    wgt += qShape->ngp;
+  }
 
-      node[0] = el->nd[0];                 // corner nodes
-      node[1] = el->nd[1];
-      node[2] = el->nd[2];                 // midside node
+  //////////////////////////////////////////////////////////////////////////////////////
+  // MPI: sum of discharge Q from all subdomains
+# ifdef _MPI_
+  Q = subdom->Mpi_sum( Q );
+# endif
+  //////////////////////////////////////////////////////////////////////////////////////
 
-      // initialize the specific discharge profile q = pow(h,3/2)
-      for( int i=0; i<nnd; i++ )
-      {
-        if( isFS(node[i]->flag, NODE::kDry) || isFS(node[i]->flag, NODE::kMarsh) )
-        {
-          q[i] = 0.0;
-        }
-        else
-        {
-          double h = Sspec - node[i]->z;
-          if( h > 0.0 )  q[i] = sqrt( h*h*h );
-          else           q[i] = 0.0;
+  return Q;
+}
 
-          double cf = node[i]->cf;
-          if( cf > 0.0 )  q[i] /= sqrt(cf);
-        }
 
-        node[i]->mark = true;
-      }
+// release boundary values, which have been overwritten after Inlet()
 
-      // integrate the specific discharge profile
-      for( int g=0; g<qShape->ngp; g++ )       // loop on GAUSS points
-      {
-        double* N  = qShape->f[g];             // quadratic shape
-        double* dN = qShape->dfdx[g];
+void BCONLINE::CheckInlet()
+{
+  for( int i=0; i<nlineNd; i++ )
+  {
+    if( lineVal[i]  &&  lineVal[i]->U != Specific(lineNd[i]) * Qratio )  lineVal[i] = NULL;
+  }
+}
 
-        // compute normal vector at Gauss point g
-        double dx = dN[0]*node[0]->x + dN[1]*node[1]->x + dN[2]*node[2]->x;
-        double dy = dN[0]*node[0]->y + dN[1]*node[1]->y + dN[2]*node[2]->y;
 
-        double qg = N[0]*q[0] + N[1]*q[1] + N[2]*q[2];
+void BCONLINE::UpdateInlet()
+{
+  double Q = Profile();
 
-        double weight = qShape->weight[g] * sqrt(dx*dx + dy*dy);
+  Qratio = -Qspec/Q;
 
-        Q += weight * qg;
-      }
-    }
+  for( int i=0; i<nlineNd; i++ )
+  {
+    if( lineVal[i] )  lineVal[i]->U = Specific(lineNd[i]) * Qratio;
+  }
+}
 
-    //////////////////////////////////////////////////////////////////////////////////////
-    // MPI: sum of discharge Q from all subdomains
-#   ifdef _MPI_
-    Q = model->subdom->Mpi_sum( Q );
-#   endif
-    //////////////////////////////////////////////////////////////////////////////////////
 
-//  double Qratio = (Q > 0.0)? (-fabs(Qspec/Q)) : (0.0);
-    double Qratio = -Qspec/Q;
+//////////////////////////////////////////////////////////////////////////////////////////
+
+int BCONLINE::Inlet( MODEL*, TIME* actualTime, int b, BCON* bcon )
+{
+  int  firstMiss = true;
+  char text[120];
+
+  ////////////////////////////////////////////////////////////////////////////////////////
+  // BCON::kQInlet
+  ////////////////////////////////////////////////////////////////////////////////////////
+
+  if( isFS(kind, BCON::kQInlet) )
+  {
+    // determine discharge for actual time -----------------------------------------------
+    Discharge( actualTime );
+
+    // compute a specific discharge profile ----------------------------------------------
+    double Q = Profile();
+
+//  Qratio = (Q > 0.0)? (-fabs(Qspec/Q)) : (0.0);
+    Qratio = -Qspec/Q;
 
     // set boundary conditions at nodes --------------------------------------------------
 
-    for( int i=0; i<rg->Getnp(); i++ )
+    // nodes of the control line are visited in the order of node numbers
+    SortNodes();
+
+    for( int i=0; i<nlineNd; i++ )
     {
-      NODE* nd = rg->Getnode(i);
+      NODE* nd = lineNd[i];
 
-      // regard only marked nodes on the control line
-      if( nd->mark )
-      {
-        double q = 0.0;
+      double q = Specific( nd );
 
-        if( isFS(nd->flag, NODE::kDry) || isFS(nd->flag, NODE::kMarsh) )
-        {
-          q = 0.0;
-        }
-        else
-        {
-          double h = Sspec - nd->z;
-          if( h > 0.0 )  q = sqrt( h*h*h );
-          else           q = 0.0;
+      nd->mark = true;
 
-          double cf = nd->cf;
-          if( cf > 0.0 )  q /= sqrt(cf);
-        }
+      BCON* bc = FindBcon( nd->Getno(), b, bcon );
 
-        BCON* bc = FindBcon( nd->Getno(), b, bcon );
+      lineVal[i] = NULL;
 
-        if( !bc )
-        {
-          bcon[b].no     = nd->Getno();
-          bcon[b].kind   = kind;
+      if( !bc )
+      {
+        bcon[b].no     = nd->Getno();
+        bcon[b].kind   = kind;
 
-          bcon[b].val->U = q * Qratio;
-          bcon[b].val->S = Sspec;
+        bcon[b].val->U = q * Qratio;
+        bcon[b].val->S = Sspec;
 
-          b++;
-        }
-        else if( bc->Consistent(kind) )
-        {
-          bc->kind  |= kind;
+        lineVal[i] = bcon[b].val;
 
-          bc->val->U = q * Qratio;
-          bc->val->S = Sspec;
-        }
+        b++;
+      }
+      else if( bc->Consistent(kind) )
+      {
+        bc->kind  |= kind;
+
+        bc->val->U = q * Qratio;
+        bc->val->S = Sspec;
+
+        lineVal[i] = bc->val;
       }
     }
 
@@ -413,11 +690,9 @@ int BCONLINE::Inlet( MODEL* model, TIME* actualTime, int b, BCON* bcon )
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -457,11 +732,9 @@ int BCONLINE::Inlet( MODEL* model, TIME* actualTime, int b, BCON* bcon )
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -536,13 +809,11 @@ int BCONLINE::Inlet( MODEL* model, TIME* actualTime, int b, BCON* bcon )
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
-int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *preQ )
+int BCONLINE::Outlet( MODEL*, TIME *actualTime, int b, BCON *bcon, double *preQ )
 {
   int  firstMiss = true;
   char text[120];
 
-  GRID *ct = model->control;
-
   ////////////////////////////////////////////////////////////////////////////////////////
   // BCON::kSQOutlet
   ////////////////////////////////////////////////////////////////////////////////////////
@@ -552,11 +823,9 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
     double Q = 0.0;
 
     // compute discharge through line
-    for( int c=0; c<ct->Getne(); c++ )
+    for( int c=0; c<nlineEl; c++ )
     {
-      ELEM* el = ct->Getelem(c);
-
-      if( el->type != no )  continue;
+      ELEM* el = lineEl[c];
 
       SHAPE* lShape = el->GetLShape();
       SHAPE* qShape = el->GetQShape();
@@ -598,7 +867,7 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
     //////////////////////////////////////////////////////////////////////////////////////
     // MPI: sum of discharge Q from all subdomains
 #   ifdef _MPI_
-    Q = model->subdom->Mpi_sum( Q );
+    Q = subdom->Mpi_sum( Q );
 #   endif
     //////////////////////////////////////////////////////////////////////////////////////
 
@@ -615,28 +884,44 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
     }
     else
     {
-      for( int j=1; j<ndat; j++ )
+      // find the first support point j with Q <= LQ[j]; binary search on ascending LQ
+      int j = 1;
+
+      if( sortU )
       {
-        SQ = LS[j];
-        SG = gct[j].So;
+        int hi = ndat;
 
-        if( Q <= LQ[j] )
+        while( j < hi )
         {
-          SQ = LS[j-1]     + (LS[j]-LS[j-1])         * (Q-LQ[j-1]) / (LQ[j]-LQ[j-1]);
-          SG = gct[j-1].So + (gct[j].So-gct[j-1].So) * (Q-LQ[j-1]) / (LQ[j]-LQ[j-1]);
-          break;
+          int mid = (j + hi) / 2;
+
+          if( Q <= LQ[mid] )  hi = mid;
+          else                j  = mid + 1;
         }
       }
+      else
+      {
+        while( j < ndat  &&  Q > LQ[j] )  j++;
+      }
+
+      if( j < ndat )
+      {
+        SQ = LS[j-1]     + (LS[j]-LS[j-1])         * (Q-LQ[j-1]) / (LQ[j]-LQ[j-1]);
+        SG = gct[j-1].So + (gct[j].So-gct[j-1].So) * (Q-LQ[j-1]) / (LQ[j]-LQ[j-1]);
+      }
+      else
+      {
+        SQ = LS[ndat-1];
+        SG = gct[ndat-1].So;
+      }
     }
 
     // relaxed change of Q
     if( preQ  &&  *preQ > 0.0 )  SQ = (SQ + *preQ) / 2.0;
 
-    for( int c=0; c<ct->Getne(); c++ )
+    for( int c=0; c<nlineEl; c++ )
     {
-      ELEM* el = ct->Getelem(c);
-
-      if( el->type != no ) continue;
+      ELEM* el = lineEl[c];
 
       int nnd = el->Getnnd();
 
@@ -702,7 +987,7 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
     double gaugeSo = gct[0].So;
 
     double L;
-    int j = FindInterval( actualTime->Getsec(), 0.0, ndat, x, NULL, &L );
+    int j = FindTime( actualTime->Getsec(), &L );
 
 
     if( j >= 0 )
@@ -712,11 +997,9 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
       gaugeSo = gct[j].So  +  L * (gct[j+1].So - gct[j].So);
     }
 
-    for( int c=0; c<ct->Getne(); c++ )
+    for( int c=0; c<nlineEl; c++ )
     {
-      ELEM *el = ct->Getelem(c);
-
-      if( el->type != no )  continue;
+      ELEM* el = lineEl[c];
 
       int nnd = el->Getnnd();
 
@@ -761,11 +1044,9 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM *el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -805,11 +1086,9 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -883,14 +1162,11 @@ int BCONLINE::Outlet( MODEL*model, TIME *actualTime, int b, BCON *bcon, double *
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
-int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long* ki )
+int BCONLINE::Further( MODEL*, TIME* actualTime, int b, BCON* bcon, long* ki )
 {
   int  firstMiss = true;
   char text[120];
 
-  GRID* ct = model->control;
-  GRID* rg = model->region;
-
 
   ////////////////////////////////////////////////////////////////////////////////////////
   // BCON::kOpenBnd
@@ -898,11 +1174,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
   if( isFS(kind, BCON::kOpenBnd) )
   {
-    for( int c=0; c<ct->Getne(); c++ )
+    for( int c=0; c<nlineEl; c++ )
     {
-      ELEM* el = ct->Getelem(c);
-
-      if( el->type != no )  continue;
+      ELEM* el = lineEl[c];
 
       int nnd = el->Getnnd();
 
@@ -943,11 +1217,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -987,11 +1259,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1067,11 +1337,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
   if( isFS(kind, BCON::kLoglaw) )
   {
-    for( int c=0; c<ct->Getne(); c++ )
+    for( int c=0; c<nlineEl; c++ )
     {
-      ELEM* el = ct->Getelem(c);
-
-      if( el->type != no )  continue;
+      ELEM* el = lineEl[c];
 
       int nnd = el->Getnnd();
 
@@ -1118,11 +1386,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1157,11 +1423,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1233,11 +1497,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1274,11 +1536,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1353,11 +1613,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1392,11 +1650,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1468,11 +1724,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
   {
     if( ndat == 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -1507,11 +1761,9 @@ int BCONLINE::Further( MODEL* model, TIME* actualTime, int b, BCON* bcon, long*
 
     else // if( count > 1 )
     {
-      for( int c=0; c<ct->Getne(); c++ )
+      for( int c=0; c<nlineEl; c++ )
       {
-        ELEM* el = ct->Getelem(c);
-
-        if( el->type != no )  continue;
+        ELEM* el = lineEl[c];
 
         int nnd = el->Getnnd();
 
@@ -68,6 +68,8 @@ BCONSET::BCONSET()
   bcval       = NULL;
 
   ngct = 0;
+
+  stateDep = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -94,7 +96,6 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
   char text[200];
 
   MODEL* model = project->M2D;
-  GRID*  ct    = model->control;
   GRID*  rg    = model->region;
 
   // class members:
@@ -118,25 +119,14 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
   }
 
   // loop over all boundary condition lines of actuall set ($TM_BOUND_LINE)
+  // the (1D-)elements and nodes of control lines are set up by BCONLINE::Prepare():
+  // lines are specified by their MAT-ID (el->type == bcLine[i].no)
   for( int i=0; i<nofLines; i++ )
   {
-    // loop over all (1D-)elements on control lines
-    for( int c=0; c<ct->Getne(); c++ )
-    {
-      ELEM* el = ct->Getelem(c); // element c on the control line
-
-      // (Control)lines are specified by their MAT-ID
-      // To get only lines with a boundary condition
-      // we are looking for identical number
-      // in MAT-ID (el->type) and $TM_BOUND_LINE (bcLine[i].no)
+    bcLine[i].Prepare( model );
 
-      if( el->type == bcLine[i].no )
-      {
-        int nnd = el->Getnnd();
-        // mark nodes of the element with boundary condition
-        for( int j=0; j<nnd; j++ ) el->nd[j]->mark = true;
-      }
-    }
+    // mark nodes of the elements with boundary condition
+    for( int j=0; j<bcLine[i].nlineNd; j++ )  bcLine[i].lineNd[j]->mark = true;
   }
 
   // loop on all nodes
@@ -179,6 +169,8 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
   // set up boundary conditions for lines
   nbc = 0;     // reset nbc to zero
 
+  BCONLINE::ResetIndex( rg->Getnp() );
+
   for( int i=0; i<nofLines; i++ )
   {
     // transfer boundary conditions from lines to nodes
@@ -186,6 +178,15 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
     nbc = bcLine[i].GenBcon( model, actualTime, nbc, bc, preQ );
   }
 
+  // S(Q)-outlets and gauge controlled outlets depend on the flow state and are to be
+  // set up in each iteration; discharge inlets are updated by UpdateBcon()
+  stateDep = ( project->ngauge > 0 );
+
+  for( int i=0; i<nofLines; i++ )
+  {
+    if( isFS(bcLine[i].kind, BCON::kSQOutlet) )  stateDep = true;
+  }
+
   ////////////////////////////////////////////////////////////////////////////////////////
   // communicate generated boundary conditions for lines
   // !!! to check if this is necessary !!! (sc, 19.07.2005)
@@ -322,6 +323,13 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
     }
   }
 
+  // boundary values of discharge inlets, which have been overwritten by further lines
+  // or nodes, are not updated by UpdateBcon()
+  for( int i=0; i<nofLines; i++ )
+  {
+    if( isFS(bcLine[i].kind, BCON::kQInlet) )  bcLine[i].CheckInlet();
+  }
+
   // -------------------------------------------------------------------------------------
   // remove boundary conditions from previous time step and initialize some values
 
@@ -740,6 +748,41 @@ void BCONSET::InitBcon( PROJECT* project, TIME* actualTime, double* preQ )
   MEMORY::memo.Detach( patchArea );
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// The boundary conditions set up by InitBcon() depend on time and on the dry and wet
+// state of the mesh, but not on the flow state, unless stateDep is set. Within the
+// iterations of a time step UpdateBcon() recomputes the state dependent parts: the
+// distribution of discharge at inlets, which depends on friction, and the wall
+// friction of the logarithmic law at nodes.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+void BCONSET::UpdateBcon( PROJECT* project )
+{
+  GRID* rg = project->M2D->region;
+
+  for( int i=0; i<nofLines; i++ )
+  {
+    if( isFS(bcLine[i].kind, BCON::kQInlet) )  bcLine[i].UpdateInlet();
+  }
+
+  for( int i=0; i<nbc; i++ )
+  {
+    if( isFS(bc[i].kind, BCON::kLoglaw) )
+    {
+      NODE* nd = rg->Getnode( bc[i].no );
+
+      double U  = nd->v.U;
+      double V  = nd->v.V;
+      double Us = sqrt( U*U + V*V );
+
+      double dw = bc[i].val->dw;        // wall distance
+      double kw = bc[i].val->kw;        // roughness height
+
+      nd->cfw = Loglaw( Us, dw, kw, project->kappa, project->vk, project->g );
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute friction coefficient for wall roughness (logarithmic law of the wall)
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,339 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class BUCKET
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Defs.h"
+#include "Report.h"
+#include "Node.h"
+#include "Elem.h"
+#include "Grid.h"
+
+#include "Bucket.h"
+
+
+BUCKET::BUCKET()
+{
+  grid    = NULL;
+  nx      = ny = 0;
+  ndStart = NULL;
+  ndList  = NULL;
+  elStart = NULL;
+  elList  = NULL;
+}
+
+
+BUCKET::~BUCKET()
+{
+  Free();
+}
+
+
+void BUCKET::Free()
+{
+  if( ndStart )  delete[] ndStart;
+  if( ndList )   delete[] ndList;
+  if( elStart )  delete[] elStart;
+  if( elList )   delete[] elList;
+
+  grid    = NULL;
+  nx      = ny = 0;
+  ndStart = NULL;
+  ndList  = NULL;
+  elStart = NULL;
+  elList  = NULL;
+}
+
+
+int BUCKET::Column( double x )
+{
+  int i = (int) floor( (x - x0) / size );
+
+  if( i < 0 )    i = 0;
+  if( i >= nx )  i = nx - 1;
+
+  return i;
+}
+
+
+int BUCKET::Row( double y )
+{
+  int j = (int) floor( (y - y0) / size );
+
+  if( j < 0 )    j = 0;
+  if( j >= ny )  j = ny - 1;
+
+  return j;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// build the index: buckets are sized for about two nodes each
+
+void BUCKET::Build( GRID* rg )
+{
+  Free();
+
+  grid = rg;
+
+  int np = rg->Getnp();
+  int ne = rg->Getne();
+
+  if( np <= 0 )  return;
+
+  double xmin = rg->Getnode(0)->x;
+  double xmax = xmin;
+  double ymin = rg->Getnode(0)->y;
+  double ymax = ymin;
+
+  for( int i=1; i<np; i++ )
+  {
+    NODE* nd = rg->Getnode(i);
+
+    if( nd->x < xmin )  xmin = nd->x;
+    if( nd->x > xmax )  xmax = nd->x;
+    if( nd->y < ymin )  ymin = nd->y;
+    if( nd->y > ymax )  ymax = nd->y;
+  }
+
+  double dx = xmax - xmin;
+  double dy = ymax - ymin;
+
+  size = sqrt( 2.0 * dx * dy / np );
+
+  if( size < 1.0e-6 * (dx + dy) )  size = 1.0e-6 * (dx + dy);
+  if( size < 1.0e-9 )              size = 1.0;
+
+  x0 = xmin;
+  y0 = ymin;
+  nx = (int) (dx / size) + 1;
+  ny = (int) (dy / size) + 1;
+
+  int nb = nx * ny;
+
+  ndStart = new int [nb+1];
+  ndList  = new int [np];
+  elStart = new int [nb+1];
+
+  if( !ndStart  ||  !ndList  ||  !elStart )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - BUCKET::Build(1)" );
+
+  // nodes: count per bucket, then fill ---------------------------------------------------
+  for( int b=0; b<=nb; b++ )  ndStart[b] = 0;
+
+  for( int i=0; i<np; i++ )
+  {
+    NODE* nd = rg->Getnode(i);
+    ndStart[Row(nd->y)*nx + Column(nd->x) + 1]++;
+  }
+
+  for( int b=0; b<nb; b++ )  ndStart[b+1] += ndStart[b];
+
+  for( int i=0; i<np; i++ )
+  {
+    NODE* nd = rg->Getnode(i);
+    ndList[ndStart[Row(nd->y)*nx + Column(nd->x)]++] = i;
+  }
+
+  for( int b=nb; b>0; b-- )  ndStart[b] = ndStart[b-1];
+  ndStart[0] = 0;
+
+  // elements: register in all buckets overlapped by the bounding box of corners --------
+  for( int b=0; b<=nb; b++ )  elStart[b] = 0;
+
+  for( int pass=0; pass<2; pass++ )
+  {
+    for( int e=0; e<ne; e++ )
+    {
+      ELEM* el  = rg->Getelem(e);
+      int   ncn = el->Getncn();
+
+      double exmin = el->nd[0]->x;
+      double exmax = exmin;
+      double eymin = el->nd[0]->y;
+      double eymax = eymin;
+
+      for( int k=1; k<ncn; k++ )
+      {
+        if( el->nd[k]->x < exmin )  exmin = el->nd[k]->x;
+        if( el->nd[k]->x > exmax )  exmax = el->nd[k]->x;
+        if( el->nd[k]->y < eymin )  eymin = el->nd[k]->y;
+        if( el->nd[k]->y > eymax )  eymax = el->nd[k]->y;
+      }
+
+      for( int j=Row(eymin); j<=Row(eymax); j++ )
+      {
+        for( int i=Column(exmin); i<=Column(exmax); i++ )
+        {
+          if( pass == 0 )  elStart[j*nx + i + 1]++;
+          else             elList[elStart[j*nx + i]++] = e;
+        }
+      }
+    }
+
+    if( pass == 0 )
+    {
+      for( int b=0; b<nb; b++ )  elStart[b+1] += elStart[b];
+
+      elList = new int [elStart[nb] + 1];
+
+      if( !elList )
+        REPORT::rpt.Error( kMemoryFault, "can not allocate memory - BUCKET::Build(2)" );
+    }
+  }
+
+  for( int b=nb; b>0; b-- )  elStart[b] = elStart[b-1];
+  elStart[0] = 0;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// nearest node: search rings of buckets around the point until the distance to the
+// ring exceeds the distance of the nearest node found
+
+NODE* BUCKET::Nearest( double x, double y )
+{
+  if( !grid )  return NULL;
+
+  int ic = Column( x );
+  int jc = Row( y );
+
+  NODE*  best  = NULL;
+  double dbest = 0.0;
+
+  int rmax = (nx > ny)?  nx : ny;
+
+  for( int r=0; r<=rmax; r++ )
+  {
+    for( int j=jc-r; j<=jc+r; j++ )
+    {
+      if( j < 0  ||  j >= ny )  continue;
+
+      for( int i=ic-r; i<=ic+r; i++ )
+      {
+        if( i < 0  ||  i >= nx )  continue;
+
+        // visit the buckets on the ring only
+        if( j != jc-r  &&  j != jc+r  &&  i != ic-r  &&  i != ic+r )  continue;
+
+        int b = j*nx + i;
+
+        for( int k=ndStart[b]; k<ndStart[b+1]; k++ )
+        {
+          NODE*  nd = grid->Getnode( ndList[k] );
+          double d  = (nd->x - x)*(nd->x - x) + (nd->y - y)*(nd->y - y);
+
+          if( !best  ||  d < dbest )
+          {
+            best  = nd;
+            dbest = d;
+          }
+        }
+      }
+    }
+
+    // points outside of ring r are farther than r*size from (x,y)
+    if( best  &&  dbest <= r*size * r*size )  break;
+  }
+
+  return best;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// element containing the point: the corner nodes are tested as polygon, so that curved
+// element edges are not regarded
+
+ELEM* BUCKET::Inside( double x, double y )
+{
+  if( !grid )  return NULL;
+
+  double xmax = x0 + nx*size;
+  double ymax = y0 + ny*size;
+
+  if( x < x0  ||  y < y0  ||  x > xmax  ||  y > ymax )  return NULL;
+
+  int b = Row(y)*nx + Column(x);
+
+  for( int k=elStart[b]; k<elStart[b+1]; k++ )
+  {
+    ELEM* el  = grid->Getelem( elList[k] );
+    int   ncn = el->Getncn();
+
+    int pos = 0;
+    int neg = 0;
+
+    for( int i=0; i<ncn; i++ )
+    {
+      NODE* n1 = el->nd[i];
+      NODE* n2 = el->nd[(i+1)%ncn];
+
+      double cross = (n2->x - n1->x) * (y - n1->y)  -  (n2->y - n1->y) * (x - n1->x);
+
+      if( cross > 0.0 )  pos++;
+      if( cross < 0.0 )  neg++;
+    }
+
+    if( !pos  ||  !neg )  return el;
+  }
+
+  return NULL;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// nodes inside of the rectangle [xmin,xmax] x [ymin,ymax]; the indices of the nodes are
+// stored in list[], which has to be of size np; returns the number of nodes
+
+int BUCKET::Nodes( double xmin, double ymin, double xmax, double ymax, int* list )
+{
+  if( !grid )  return 0;
+
+  int n = 0;
+
+  for( int j=Row(ymin); j<=Row(ymax); j++ )
+  {
+    for( int i=Column(xmin); i<=Column(xmax); i++ )
+    {
+      int b = j*nx + i;
+
+      for( int k=ndStart[b]; k<ndStart[b+1]; k++ )
+      {
+        NODE* nd = grid->Getnode( ndList[k] );
+
+        if(    nd->x >= xmin  &&  nd->x <= xmax
+            && nd->y >= ymin  &&  nd->y <= ymax )  list[n++] = ndList[k];
+      }
+    }
+  }
+
+  return n;
+}
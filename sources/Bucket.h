@@ -0,0 +1,102 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// B U C K E T
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// FILES
+//
+// Bucket.h   : definition file of the class.
+// Bucket.cpp : implementation file of the class.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// DESCRIPTION
+//
+// This class implements a spatial index of a grid: a uniform grid of square buckets over the
+// bounding box of nodes, which lists the nodes located in each bucket and the elements whose
+// bounding box overlaps the bucket. It supports the following queries:
+//
+//   Nearest()  : nearest node to a point
+//   Inside()   : element containing a point
+//   Nodes()    : nodes inside of a rectangle, e.g. the bounding box of a section strip
+//
+// The index refers to the arrays of nodes and elements of the grid and has to be built again
+// with Build(), if these arrays change.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// -------------------------------------------------------------------------------------------------
+//
+// HISTORY
+//
+//    date              changes
+// ------------  ----  -----------------------------------------------------------------------------
+//  19.10.2026    ag    first implementation: spatial index for GRID::bucket
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BUCKET_INCL
+#define BUCKET_INCL
+
+class NODE;
+class ELEM;
+class GRID;
+
+
+class BUCKET
+{
+  private:
+    GRID*   grid;
+
+    double  x0, y0;             // lower left corner of the bucket grid
+    double  size;               // edge length of buckets
+    int     nx, ny;             // number of buckets in x- and y-direction
+
+    int*    ndStart;            // nodes in bucket b: ndList[ndStart[b]] ... ndList[ndStart[b+1]-1]
+    int*    ndList;
+    int*    elStart;            // elements overlapping bucket b: elList[elStart[b]] ...
+    int*    elList;
+
+  public:
+    BUCKET();
+    ~BUCKET();
+
+    void    Build( GRID* grid );
+    void    Free();
+
+    NODE*   Nearest( double x, double y );
+    ELEM*   Inside( double x, double y );
+    int     Nodes( double xmin, double ymin, double xmax, double ymax, int* list );
+
+  private:
+    int     Column( double x );
+    int     Row( double y );
+};
+
+#endif
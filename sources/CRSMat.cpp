@@ -465,6 +465,13 @@ void CRSMAT::Set( int r, int i, REALPR v )
 
 double* CRSMAT::MulVec( double* x, double* r, PROJECT* project, EQS* eqs )
 {
+  // Jacobian-free Newton-Krylov: the product is approximated by the equation system
+  if( eqs  &&  eqs->jfnk )
+  {
+    eqs->MulVecFD( x, r, project );
+    return r;
+  }
+
   for( int i=0; i<m_neq; i++ )
   {
     // multiplicate row "i" of "A" with "x"
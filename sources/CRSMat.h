@@ -12,6 +12,10 @@
 // Assemble.cpp : methods CRSMAT::AssembleEstifm_im()
 //                        CRSMAT::AssembleEqs_im()
 //                        CRSMAT::AssembleForce()
+//                        CRSMAT::Assemble()
+//                        CRSMAT::InsertEqs()
+//                        CRSMAT::InsertForce()
+//                        CRSMAT::InsertBatch()
 //
 // -------------------------------------------------------------------------------------------------
 //
@@ -53,6 +57,8 @@
 //    date               description
 // ----------   ------   ----------------------------------------------------------------
 // 01.01.1994     sc     first implementation
+// 19.10.2026     ag     assembly of element coefficients computed in batches
+// 19.10.2026     ag     Assemble(): single pass for residual, matrix and auxiliary values
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +68,7 @@
 #include "Defs.h"
 
 class EQS;
+class ELEM;
 class SUBDOM;
 class MODEL;
 class PROJECT;
@@ -135,6 +142,11 @@ class CRSMAT
     void    AssembleEstifm_im( EQS* eqs, MODEL* m, PROJECT* p );
     void    AssembleEqs_im( EQS* eqs, double* rhs, MODEL* m, PROJECT* p );
     void    AssembleForce( EQS* eqs, double* rhs, MODEL* m, PROJECT* p );
+    void    Assemble( EQS* eqs, double* rhs, MODEL* m, PROJECT* p, int matrix, int aux );
+
+    void    InsertEqs( EQS* eqs, ELEM* el, double** estifm, double* force, double* rhs );
+    void    InsertForce( EQS* eqs, ELEM* el, double* force, double* rhs );
+    void    InsertBatch( EQS* eqs, int nb, ELEM** batch, PROJECT* p, double* rhs, int aux );
 };
 
 #endif
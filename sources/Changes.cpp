@@ -0,0 +1,130 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class CHANGES
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Defs.h"
+#include "Report.h"
+#include "Node.h"
+#include "Grid.h"
+
+#include "Changes.h"
+
+
+CHANGES::CHANGES()
+{
+  np    = 0;
+  valid = false;
+  U     = V = H = NULL;
+}
+
+
+CHANGES::~CHANGES()
+{
+  Free();
+}
+
+
+void CHANGES::Free()
+{
+  if( U )  delete[] U;
+
+  np    = 0;
+  valid = false;
+  U     = V = H = NULL;
+}
+
+
+void CHANGES::Reset()
+{
+  valid = false;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Flag the changed nodes in mark[] (if not NULL) and return their number; on the first
+// call and after Reset() all nodes are changed.
+
+int CHANGES::Mark( GRID* rg, double dUV, double dH, char* mark )
+{
+  if( rg->Getnp() != np )
+  {
+    Free();
+
+    np = rg->Getnp();
+    U  = new double [3*np];
+
+    if( !U )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - CHANGES::Mark(1)" );
+
+    V  = U + np;
+    H  = V + np;
+  }
+
+  int changed = 0;
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE*  nd = rg->Getnode(n);
+    double h  = nd->v.S - nd->z;
+
+    if(    !valid
+        ||  fabs(nd->v.U - U[n]) > dUV
+        ||  fabs(nd->v.V - V[n]) > dUV
+        ||  fabs(h       - H[n]) > dH  )
+    {
+      U[n] = nd->v.U;
+      V[n] = nd->v.V;
+      H[n] = h;
+
+      if( mark )  mark[n] = true;
+      changed++;
+    }
+
+    else
+    {
+      if( mark )  mark[n] = false;
+    }
+  }
+
+  valid = true;
+
+  return changed;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// take the actual state of all nodes as reference
+
+void CHANGES::Store( GRID* rg )
+{
+  Mark( rg, -1.0, -1.0 );
+}
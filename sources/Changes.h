@@ -0,0 +1,98 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// C H A N G E S
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// FILES
+//
+// Changes.h   : definition file of the class.
+// Changes.cpp : implementation file of the class.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// DESCRIPTION
+//
+// This class reminds the state of nodes (U, V and flow depth H) at the last evaluation of a
+// derived quantity like friction or eddy viscosity, so that the quantity is recomputed only at
+// nodes, whose state has changed by more than given limits.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// -------------------------------------------------------------------------------------------------
+//
+// HISTORY
+//
+//    date              changes
+// ------------  ----  -----------------------------------------------------------------------------
+//  19.10.2026    ag    first implementation as class FIELDS: node arrays GRID::field
+//  19.10.2026    ag    change detection of the node state for friction and eddy viscosity
+//  19.10.2026    ag    node arrays removed; change detection kept as class CHANGES
+//  19.10.2026    ag    negative limits mark all nodes
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANGES_INCL
+#define CHANGES_INCL
+
+#include "Defs.h"
+
+
+class GRID;
+
+
+// ---------------------------------------------------------------------------------------
+// CHANGES reminds the node state (U,V,H) at the last evaluation of a derived quantity,
+// like friction or eddy viscosity. Mark() flags the nodes, whose state has changed by
+// more than the limits dUV and dH since then, and takes their state as new reference.
+// Negative limits mark all nodes. Even with limits of zero a skipped node may differ
+// from a recomputation: the Colebrook-White iteration of friction starts from its last
+// solution NODE::cw and changes the coefficient slightly at unchanged state.
+
+class CHANGES
+{
+  public:
+    int           np;             // number of nodes
+
+  private:
+    int           valid;          // reference state is valid
+    double*       U;              // reference state
+    double*       V;
+    double*       H;
+
+  public:
+    CHANGES();
+    ~CHANGES();
+
+    int  Mark( GRID* rg, double dUV, double dH, char* mark =NULL );
+    void Store( GRID* rg );
+    void Reset();
+    void Free();
+};
+
+#endif
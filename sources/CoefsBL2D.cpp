@@ -215,6 +215,29 @@ void EQS_BL2D::Bound( ELEM*    elem,
 }
 
 
+void EQS_BL2D::Region( ELEM*    elem,
+                       PROJECT* project,
+                       double** estifm,
+                       double*  force,
+                       SHAPE*   shape )
+{
+  // dispatch to the kernel specialised for the number of element nodes
+
+  switch( shape->nnd )
+  {
+    case 3:  Region<3>( elem, project, estifm, force, shape );  break;
+    case 4:  Region<4>( elem, project, estifm, force, shape );  break;
+    case 6:  Region<6>( elem, project, estifm, force, shape );  break;
+    case 8:  Region<8>( elem, project, estifm, force, shape );  break;
+
+    default:
+      REPORT::rpt.Error( kParameterFault, "unsupported element shape - EQS_BL2D::Region(1)" );
+      break;
+  }
+}
+
+
+template< int kNnd >
 void EQS_BL2D::Region( ELEM*    elem,
                        PROJECT* project,
                        double** estifm,
@@ -227,7 +250,7 @@ void EQS_BL2D::Region( ELEM*    elem,
   SED* sed = &project->sed;
 
   int ngp = shape->ngp;            // number of GAUSS points
-  int nnd = shape->nnd;            // number of nodes
+  const int nnd = kNnd;            // number of nodes
 
   if( force )  for( int i=0; i<maxEleq; i++ )  force[i] = 0.0;
 
@@ -393,17 +416,21 @@ void EQS_BL2D::Region( ELEM*    elem,
     else if( isFS(nd->bc.kind, BCON::kRateC) )
     {
       // compute transport on inlet boundary -----------------------------------------------
+      // a specified rate is distributed to grain fractions with the substrate composition
 
       double qbin = 0.0;
+      double qbsp = nd->bc.val->Qb[0];
+
+      if( sed->frac >= 0  &&  qbsp > 0.0 )  qbsp *= sed->pk[sed->frac];
 
-      if( nd->bc.val->Qb[0] < 0.0 )
+      if( qbsp < 0.0 )
       {
-         qbin = fabs(nd->bc.val->Qb[0]) * sed->qbc[no];
+         qbin = fabs(qbsp) * sed->qbc[no];
       }
       else
       {
-        if( nd->bc.val->Qb[0] <= sed->qbc[no] )  qbin = nd->bc.val->Qb[0];
-        else                                     qbin = sed->qbc[no];
+        if( qbsp <= sed->qbc[no] )  qbin = qbsp;
+        else                        qbin = sed->qbc[no];
       }
 
       force[i] = area * (qbin - nd->v.Qb);
@@ -323,11 +323,11 @@ void EQS_DZ::Region( ELEM*    elem,
     }
 
 
-    // erosion/deposition due to mud exchange with water body ----------------------------
+    // erosion/deposition due to mud exchange with water body (not for grain fractions) -
 
     double EDs = 0.0;
 
-    if( sed->M > 0.0 )
+    if( sed->M > 0.0  &&  sed->frac < 0 )
     {
       double H = 0.0;
       double M = 0.0;
@@ -392,15 +392,18 @@ void EQS_DZ::Region( ELEM*    elem,
     // compute components of NEWTON-RAPHSON Jacobi matrix
     // -----------------------------------------------------------------------------------
 
-    double df__ =  weight * por;
-
-    for( int i=0; i<ncn; i++ )
+    if( estifm )
     {
-      double* estifmPtr = estifm[i];
+      double df__ =  weight * por;
 
-      for( int j=0; j<ncn; j++ )
+      for( int i=0; i<ncn; i++ )
       {
-        estifmPtr[j] +=  m[i] * df__ * m[j];
+        double* estifmPtr = estifm[i];
+
+        for( int j=0; j<ncn; j++ )
+        {
+          estifmPtr[j] +=  m[i] * df__ * m[j];
+        }
       }
     }
   }
@@ -64,6 +64,24 @@ int EQS_KD2D::Coefs( ELEM*    elem,
       || isFS(elem->flag, ELEM::kBound) ) return 0;
 
 
+  // -------------------------------------------------------------------------------------
+  // local pseudo time step of the element; the ratio of local to global time step is
+  // limited to the growth of the global time step dt_KD / relaxTimeTurb, since the
+  // k-epsilon equations do not tolerate large time steps in the first iterations
+
+  double rdtKD = relaxThdt_KD;
+
+  if( localFac )
+  {
+    double fac = localFac[elem->Getno()];
+    double min = relaxThdt_KD * project->timeint.relaxTimeTurb.Getsec();
+
+    if( fac < min )  fac = min;
+
+    relaxThdt_KD *= fac;
+  }
+
+
   // -------------------------------------------------------------------------------------
 
   if( linearShape )
@@ -188,10 +206,32 @@ int EQS_KD2D::Coefs( ELEM*    elem,
       Region( elem, project, estifm, force );
   }
 
+  relaxThdt_KD = rdtKD;
+
   return 1;
 }
 
 
+void EQS_KD2D::Region( ELEM*    elem,
+                       PROJECT* project,
+                       double** estifm,
+                       double*  force )
+{
+  // dispatch to the kernel specialised for the element shape
+
+  switch( elem->GetQShape()->nnd )
+  {
+    case 6:  Region<6,3>( elem, project, estifm, force );  break;
+    case 8:  Region<8,4>( elem, project, estifm, force );  break;
+
+    default:
+      REPORT::rpt.Error( kParameterFault, "unsupported element shape - EQS_KD2D::Region(1)" );
+      break;
+  }
+}
+
+
+template< int kNnd, int kNcn >
 void EQS_KD2D::Region( ELEM*    elem,
                        PROJECT* project,
                        double** estifm,
@@ -214,8 +254,8 @@ void EQS_KD2D::Region( ELEM*    elem,
   SHAPE* qShape = elem->GetQShape();
 
   int ngp = qShape->ngp;                          // number of GAUSS points
-  int nnd = qShape->nnd;                          // total number of nodes
-  int ncn = lShape->nnd;                          // number of corner nodes
+  const int nnd = kNnd;                           // total number of nodes
+  const int ncn = kNcn;                           // number of corner nodes
 
   int startD = nnd;
 
@@ -226,20 +266,11 @@ void EQS_KD2D::Region( ELEM*    elem,
 
 
   // -------------------------------------------------------------------------------------
-  // compute coordinates relative to first node
-
-  double x[kMaxNodes2D], y[kMaxNodes2D];
-
-  x[0] = elem->nd[0]->x;
-  y[0] = elem->nd[0]->y;
+  // element geometry at Gauss points: weight and global derivatives (GRID::Geometry)
 
-  for( int i=1; i<nnd; i++ )
-  {
-    x[i] = elem->nd[i]->x - x[0];
-    y[i] = elem->nd[i]->y - y[0];
-  }
-
-  x[0] = y[0] = 0.0;
+  double  local[kMaxGeom];
+  double* geom = project->M2D->region->Geometry( elem, local );
+  int     size = GEOM::Size( nnd, ncn );
 
 
   // -------------------------------------------------------------------------------------
@@ -247,47 +278,15 @@ void EQS_KD2D::Region( ELEM*    elem,
 
   for( int g=0; g<ngp; g++ )
   {
-    // -----------------------------------------------------------------------------------
-    // form JACOBIAN transformation matrix with linear shape functions
-
-    double* dfdxPtr = qShape->dfdx[g];
-    double* dfdyPtr = qShape->dfdy[g];
-
-    double trafo[2][2];
+    double  weight = geom[0];
 
-    double detj   = qShape->jacobi2D( nnd, dfdxPtr, dfdyPtr, x, y, trafo );
-    double weight = detj * qShape->weight[g];
+    double* dndx   = geom + 1;             // quadratic shape functions at GP g
+    double* dndy   = dndx + nnd;
+    double* n      = qShape->f[g];
 
+    double* m      = lShape->f[g];         // linear shape functions at GP g
 
-    // -------------------------------------------------------------------------------------
-    // compute values of quadratic shape functions at GP g
-
-    double dndx[kMaxNodes2D], dndy[kMaxNodes2D];
-
-    double* n = qShape->f[g];
-
-    for( int j=0; j<nnd; j++ )
-    {
-      dndx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
-      dndy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
-    }
-
-
-    // ------------------------------------------------------------------------------------
-    // values of linear shape functions at GP g
-
-    double  dmdx[kMaxNodes2D], dmdy[kMaxNodes2D];
-
-    dfdxPtr = lShape->dfdx[g];
-    dfdyPtr = lShape->dfdy[g];
-
-    double* m = lShape->f[g];
-
-    for( int j=0; j<ncn; j++ )
-    {
-      dmdx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
-      dmdy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
-    }
+    geom += size;
 
 
     // -----------------------------------------------------------------------------------
@@ -227,22 +227,6 @@ void EQS_SL2D::Region( ELEM*    elem,
   }
 
 
-  // -------------------------------------------------------------------------------------
-  // compute coordinates relative to first node
-
-  double x[kMaxNodes2D], y[kMaxNodes2D];
-
-  x[0] = elem->nd[0]->x;
-  y[0] = elem->nd[0]->y;
-
-  for( int i=1; i<nnd; i++ )
-  {
-    x[i] = elem->nd[i]->x - *x;
-    y[i] = elem->nd[i]->y - *y;
-  }
-
-  x[0] = y[0] = 0.0;
-
   TYPE* type = TYPE::Getid( elem->type );
 
   double rho  = project->rho;
@@ -256,38 +240,24 @@ void EQS_SL2D::Region( ELEM*    elem,
   // -------------------------------------------------------------------------------------
   // use GAUSS point integration to solve adv equation
 
+  double  local[kMaxGeom];
+  double* geom = project->M2D->region->Geometry( elem, local );
+  int     size = GEOM::Size( nnd, ncn );
+
   for( int g=0; g<ngp; g++ )
   {
     // -----------------------------------------------------------------------------------
-    // form JACOBIAN transformation matrix with linear shape functions
+    // weight and global derivatives of quadratic shape functions at GP g (GRID::Geometry)
 
-    double  trafo[2][2];
-    double* dfdxPtr = qShape->dfdx[g];
-    double* dfdyPtr = qShape->dfdy[g];
+    double  weight = geom[0];
 
-    double detj = qShape->jacobi2D( nnd, dfdxPtr, dfdyPtr, x, y, trafo );
+    double* dndx   = geom + 1;
+    double* dndy   = dndx + nnd;
 
-    double weight = detj * qShape->weight[g];
+    double* n      = qShape->f[g];
+    double* m      = lShape->f[g];
 
-
-    // -----------------------------------------------------------------------------------
-    // compute values of linear shape functions at GP i
-
-    double* m = lShape->f[g];
-
-
-    // -----------------------------------------------------------------------------------
-    // compute values of quadratic shape functions at GP i
-
-    double dndx[kMaxNodes2D], dndy[kMaxNodes2D];
-
-    double* n = qShape->f[g];
-
-    for( int j=0; j<nnd; j++ )
-    {
-      dndx[j] = trafo[0][0] * dfdxPtr[j] + trafo[0][1] * dfdyPtr[j];
-      dndy[j] = trafo[1][0] * dfdxPtr[j] + trafo[1][1] * dfdyPtr[j];
-    }
+    geom += size;
 
 
     // -----------------------------------------------------------------------------------
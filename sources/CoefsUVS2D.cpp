@@ -57,6 +57,20 @@ int EQS_UVS2D::Coefs( ELEM*    elem,
   {
     Bound( elem, project, estifm, force );
   }
+  else if( localFac )
+  {
+    // local pseudo time step of the element
+    double rdtUV = relaxThdt_UV;
+    double rdtH  = relaxThdt_H;
+
+    relaxThdt_UV *= localFac[elem->Getno()];
+    relaxThdt_H  *= localFac[elem->Getno()];
+
+    Region( elem, project, estifm, force );
+
+    relaxThdt_UV = rdtUV;
+    relaxThdt_H  = rdtH;
+  }
   else
   {
     Region( elem, project, estifm, force );
@@ -364,6 +378,355 @@ void EQS_UVS2D::Bound( ELEM*    elem,
 
 // ======================================================================================
 
+void EQS_UVS2D::Region( ELEM*    elem,
+                        PROJECT* project,
+                        double** estifm,
+                        double*  force )
+{
+  // dispatch to the kernel specialised for the element shape; the number of nodes
+  // is a compile time constant there, so that the inner loops may be unrolled
+
+  switch( elem->GetQShape()->nnd )
+  {
+    case 6:  Region<6,3>( elem, project, estifm, force );  break;
+    case 8:  Region<8,4>( elem, project, estifm, force );  break;
+
+    default:
+      REPORT::rpt.Error( kParameterFault, "unsupported element shape - EQS_UVS2D::Region(1)" );
+      break;
+  }
+}
+
+
+// ======================================================================================
+// Flow parameters at GAUSS points and the terms of the UVH-equations for L elements
+// (lanes) at once, stored as structure of arrays with the lane as index. The functions
+// UVSForce() and UVSJacobi() are shared by Region() (L = 1) and RegionBatch() (L = kBatch),
+// which differ only in the gathering of node values and the assembly of element matrices.
+
+template< int L >
+struct UVSGP
+{
+  double H[L], dHdt[L], dHdx[L], dHdy[L];       // flow depth
+  double dadx[L], dady[L];                      // bottom slope
+  double cf[L];                                 // bottom friction
+  double SS[L];                                 // Source or Sink
+  double U[L], dUdt[L], dUdx[L], dUdy[L];       // horizontal velocities
+  double V[L], dVdt[L], dVdx[L], dVdy[L];
+  double uu[L], uv[L], vv[L];                   // Reynolds stresses
+  double Dxx[L], Dxy[L], Dyy[L];                // dispersion
+  double vt[L];                                 // eddy and kinematic viscosity
+};
+
+template< int L >
+struct UVSDF                                    // coefficients of a block of the Jacobi matrix
+{
+  double df__[L], df_x[L], df_y[L];             // t  = df__ * n  +  df_x * dndx  +  df_y * dndy
+  double dfx_[L], dfxx[L], dfxy[L];             // tx = dfx_ * n  +  dfxx * dndx  +  dfxy * dndy
+  double dfy_[L], dfyx[L], dfyy[L];             // ty = dfy_ * n  +  dfyx * dndx  +  dfyy * dndy
+};
+
+
+// -------------------------------------------------------------------------------------
+// weighted residuals at GAUSS point: f[0], fx[0], fy[0] of x-momentum, f[1], fx[1],
+// fy[1] of y-momentum and f[2] of continuity; the loop over lanes is innermost
+
+template< int L >
+static inline void UVSForce( const UVSGP<L>& p, double gravity, const double* wgt,
+                             double (*f)[L], double (*fx)[L], double (*fy)[L] )
+{
+  for( int b=0; b<L; b++ )
+  {
+    double weight = wgt[b];
+
+    double H    = p.H[b];
+    double U    = p.U[b];
+    double V    = p.V[b];
+    double vt   = p.vt[b];
+
+    double Ures = sqrt( U*U + V*V );            // absolute velocity
+
+    // -----------------------------------------------------------------------------------
+    // compute x-momentum equation
+
+    f[0][b]   =  H * p.dUdt[b];                          // time
+    f[0][b]  +=  H * (U * p.dUdx[b]  +  V * p.dUdy[b]);  // convection
+    fx[0][b]  =  0.0;
+    fy[0][b]  =  0.0;
+
+    fx[0][b] +=  H * vt * (p.dUdx[b] + p.dUdx[b]);       // eddy viscosity
+    fy[0][b] +=  H * vt * (p.dUdy[b] + p.dVdx[b]);
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // fx +=  vt * (U * dHdx + U * dHdx);
+    // fy +=  vt * (U * dHdy + V * dHdx);
+    // -------------------------------------------------------------------------------------------
+
+    fx[0][b] -=  H * p.uu[b];                            // turbulence
+    fy[0][b] -=  H * p.uv[b];
+
+    f[0][b]  +=  H * gravity * p.dadx[b];                // gravity
+    fx[0][b] -=  H * H * gravity / 2.0;
+
+    f[0][b]  +=  p.cf[b] * Ures * U;                     // bottom friction
+
+    // ------------------------------------------------ dispersion
+    // fx += H * Duu;
+    // fy += H * Duv;
+
+    fx[0][b] +=  H * ( U*U*p.Dxx[b] - 2.0*U*V*p.Dxy[b] + V*V*p.Dyy[b] );
+    fy[0][b] +=  H * ( U*V*(p.Dxx[b]-p.Dyy[b]) + (U*U-V*V)*p.Dxy[b] );
+
+    f[0][b]  *= weight;
+    fx[0][b] *= weight;
+    fy[0][b] *= weight;
+
+
+    // -----------------------------------------------------------------------------------
+    // compute y-momentum equation
+
+    f[1][b]   =  H * p.dVdt[b];                          // time
+    f[1][b]  +=  H * (U * p.dVdx[b]  +  V * p.dVdy[b]);  // convection
+    fx[1][b]  =  0.0;
+    fy[1][b]  =  0.0;
+
+    fx[1][b] +=  H * vt * (p.dVdx[b] + p.dUdy[b]);       // eddy viscosity
+    fy[1][b] +=  H * vt * (p.dVdy[b] + p.dVdy[b]);
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // fx +=  vt * (V * dHdx + U * dHdy);
+    // fy +=  vt * (V * dHdy + V * dHdy);
+    // -------------------------------------------------------------------------------------------
+
+    fx[1][b] -=  H * p.uv[b];                            // turbulence
+    fy[1][b] -=  H * p.vv[b];
+
+    f[1][b]  +=  H * gravity * p.dady[b];                // gravity
+    fy[1][b] -=  H * H * gravity / 2.0;
+
+    f[1][b]  +=  p.cf[b] * Ures * V;                     // bottom friction
+
+    // ------------------------------------------------ dispersion
+    // fx += H * Duv;
+    // fy += H * Dvv;
+
+    fx[1][b] +=  H * ( U*V*(p.Dxx[b]-p.Dyy[b]) + (U*U-V*V)*p.Dxy[b] );
+    fy[1][b] +=  H * ( V*V*p.Dxx[b] + 2.0*U*V*p.Dxy[b] + U*U*p.Dyy[b] );
+
+    f[1][b]  *= weight;
+    fx[1][b] *= weight;
+    fy[1][b] *= weight;
+
+
+    // -----------------------------------------------------------------------------------
+    // compute continuity equation (solve only for corner nodes)
+
+    f[2][b]  = p.dHdt[b]  +  H * (p.dUdx[b] + p.dVdy[b])  +  U * p.dHdx[b]  +  V * p.dHdy[b];
+
+    f[2][b] *= weight;
+    f[2][b] += p.SS[b] * weight;  // Source or Sink
+  }
+}
+
+
+// -------------------------------------------------------------------------------------
+// components of NEWTON-RAPHSON Jacobi matrix at GAUSS point: d[0..2] U-, V- and
+// H-derivative of x-momentum, d[3..5] of y-momentum and d[6..8] of continuity;
+// only the coefficients used in the assembly of the block are set
+
+template< int L >
+static inline void UVSJacobi( const UVSGP<L>& p, double gravity, const double* wgt,
+                              const double* rdtUV, const double* rdtH, UVSDF<L>* d )
+{
+  for( int b=0; b<L; b++ )
+  {
+    double weight       = wgt[b];
+    double relaxThdt_UV = rdtUV[b];
+    double relaxThdt_H  = rdtH[b];
+
+    double H    = p.H[b];
+    double U    = p.U[b];
+    double V    = p.V[b];
+    double vt   = p.vt[b];
+    double cf   = p.cf[b];
+    double Dxx  = p.Dxx[b];
+    double Dxy  = p.Dxy[b];
+    double Dyy  = p.Dyy[b];
+
+    double Ures = sqrt( U*U + V*V );            // absolute velocity
+    double iUres;
+
+    if( Ures > 1.0e-9 ) iUres = 1.0 / Ures;
+    else                iUres = 0.0;
+
+
+    // U-derivative of x-momentum --------------------------------------------------------
+
+    d[0].df__[b]  =  weight * H * relaxThdt_UV;
+    d[0].df__[b] +=  weight * H * p.dUdx[b];
+    d[0].df_x[b]  =  weight * H * U;
+    d[0].df_y[b]  =  weight * H * V;
+    d[0].dfx_[b]  =  0.0;
+    d[0].dfy_[b]  =  0.0;
+
+    d[0].dfxx[b]  =  weight * H * vt * 2.0;
+    d[0].dfyy[b]  =  weight * H * vt;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfx_ +=  weight * vt * dHdx * 2.0;
+    // dfy_ +=  weight * vt * dHdy;
+    // -------------------------------------------------------------------------------------------
+
+    d[0].df__[b] +=  weight * cf * (iUres * U*U  +  Ures);
+
+    d[0].dfx_[b] +=  weight * H * ( 2.0*U*Dxx - 2.0*V*Dxy );
+    d[0].dfy_[b] +=  weight * H * ( V*(Dxx-Dyy) + 2.0*U*Dxy );
+
+
+    // V-derivative of x-momentum --------------------------------------------------------
+
+    d[1].df__[b]  =  weight * H * p.dUdy[b];
+    d[1].dfx_[b]  =  0.0;
+    d[1].dfy_[b]  =  0.0;
+
+    d[1].dfyx[b]  =  weight * H * vt;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfy_ +=  weight * vt * dHdx;
+    // -------------------------------------------------------------------------------------------
+
+    d[1].df__[b] +=  weight * cf * iUres * U * V;
+
+    d[1].dfx_[b] +=  weight * H * ( 2.0*V*Dyy - 2.0*V*Dxy );
+    d[1].dfy_[b] +=  weight * H * ( V*(Dxx-Dyy) - 2.0*V*Dxy );
+
+
+    // H-derivative of x-momentum --------------------------------------------------------
+
+    d[2].df__[b]  =  weight * p.dUdt[b];
+    d[2].df__[b] +=  weight * (U * p.dUdx[b] + V * p.dUdy[b]);
+    d[2].dfx_[b]  =  0.0;
+    d[2].dfy_[b]  =  0.0;
+
+    d[2].dfx_[b] +=  weight * vt * (p.dUdx[b] + p.dUdx[b]);
+    d[2].dfy_[b] +=  weight * vt * (p.dUdy[b] + p.dVdx[b]);
+
+    d[2].dfx_[b] -=  weight * p.uu[b];
+    d[2].dfy_[b] -=  weight * p.uv[b];
+
+    d[2].df__[b] +=  weight * gravity * p.dadx[b];
+    d[2].dfx_[b] -=  weight * gravity * H;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfxx  =  weight * vt * U * 2.0;
+    // dfyx  =  weight * vt * V;
+    // dfyy  =  weight * vt * U;
+    // -------------------------------------------------------------------------------------------
+
+    d[2].dfx_[b] +=  weight * ( U*U*Dxx - 2.0*U*V*Dxy + V*V*Dyy );
+    d[2].dfy_[b] +=  weight * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
+
+
+    // U-derivative of y-momentum --------------------------------------------------------
+
+    d[3].df__[b]  =  weight * H * p.dVdx[b];
+    d[3].dfx_[b]  =  0.0;
+    d[3].dfy_[b]  =  0.0;
+
+    d[3].dfxy[b]  =  weight * H * vt;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfx_ +=  weight * vt * dHdy;
+    // -------------------------------------------------------------------------------------------
+
+    d[3].df__[b] +=  weight * cf * iUres * U * V;
+
+    d[3].dfx_[b] +=  weight * H * ( V*(Dxx-Dyy) + 2.0*U*Dxy );
+    d[3].dfy_[b] +=  weight * H * ( 2.0*V*Dxy + 2.0*U*Dyy );
+
+
+    // V-derivative of y-momentum --------------------------------------------------------
+
+    d[4].df__[b]  =  weight * H * relaxThdt_UV;
+    d[4].df__[b] +=  weight * H * p.dVdy[b];
+    d[4].df_x[b]  =  weight * H * U;
+    d[4].df_y[b]  =  weight * H * V;
+    d[4].dfx_[b]  =  0.0;
+    d[4].dfy_[b]  =  0.0;
+
+    d[4].dfxx[b]  =  weight * H * vt;
+    d[4].dfyy[b]  =  weight * H * vt * 2.0;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfx_ +=  weight * vt * dHdx;
+    // dfy_ +=  weight * vt * dHdy * 2.0;
+    // -------------------------------------------------------------------------------------------
+
+    d[4].df__[b] +=  weight * cf * (iUres * V*V  +  Ures);
+
+    d[4].dfx_[b] +=  weight * H * ( U*(Dxx-Dyy) - 2.0*V*Dxy );
+    d[4].dfy_[b] +=  weight * H * ( 2.0*V*Dxx + 2.0*U*Dxy );
+
+
+    // H-derivative of y-momentum --------------------------------------------------------
+
+    d[5].df__[b]  =  weight * p.dVdt[b];
+    d[5].df__[b] +=  weight * (U * p.dVdx[b] + V * p.dVdy[b]);
+    d[5].dfx_[b]  =  0.0;
+    d[5].dfy_[b]  =  0.0;
+
+    d[5].dfx_[b] +=  weight * vt * (p.dVdx[b] + p.dUdy[b]);
+    d[5].dfy_[b] +=  weight * vt * (p.dVdy[b] + p.dVdy[b]);
+
+    d[5].dfx_[b] -=  weight * p.uv[b];
+    d[5].dfy_[b] -=  weight * p.vv[b];
+
+    d[5].df__[b] +=  weight * gravity * p.dady[b];
+    d[5].dfy_[b] -=  weight * gravity * H;
+
+    // -------------------------------------------------------------------------------------------
+    // The following depth-averaged Boussinesq approach leads to instabilities in LES.
+    // dfxx  =  weight * vt * V;
+    // dfxy  =  weight * vt * U;
+    // dfyy  =  weight * vt * V * 2.0;
+    // -------------------------------------------------------------------------------------------
+
+    d[5].dfx_[b] +=  weight * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
+    d[5].dfy_[b] +=  weight * ( V*V*Dxx + 2.0*U*V*Dxy + U*U*Dyy );
+
+
+    // U-derivative of continuity --------------------------------------------------------
+
+    d[6].df__[b]  = weight * p.dHdx[b];
+    d[6].df_x[b]  = weight * H;
+
+
+    // V-derivative of continuity --------------------------------------------------------
+
+    d[7].df__[b]  = weight * p.dHdy[b];
+    d[7].df_y[b]  = weight * H;
+
+
+    // H-derivative of continuity --------------------------------------------------------
+
+    d[8].df__[b]  = weight * relaxThdt_H;
+    d[8].df__[b] += weight * (p.dUdx[b] + p.dVdy[b]);
+    d[8].df_x[b]  = weight * U;
+    d[8].df_y[b]  = weight * V;
+  }
+}
+
+
+// ======================================================================================
+
+template< int kNnd, int kNcn >
 void EQS_UVS2D::Region( ELEM*    elem,
                         PROJECT* project,
                         double** estifm,
@@ -376,8 +739,8 @@ void EQS_UVS2D::Region( ELEM*    elem,
   SHAPE* qShape = elem->GetQShape();
 
   int ngp = qShape->ngp;         // number of GAUSS points
-  int nnd = qShape->nnd;         // number of nodes in all
-  int ncn = lShape->nnd;         // number of corner nodes
+  const int nnd = kNnd;          // number of nodes in all
+  const int ncn = kNcn;          // number of corner nodes
 
   TYPE* type = TYPE::Getid( elem->type );
 
@@ -406,20 +769,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
 
   // -------------------------------------------------------------------------------------
-  // compute coordinates relative to first node
-
-  double x[kMaxNodes2D], y[kMaxNodes2D];
-
-  x[0] = elem->nd[0]->x;
-  y[0] = elem->nd[0]->y;
-
-  for( int i=1; i<nnd; i++ )
-  {
-    x[i] = elem->nd[i]->x - x[0];
-    y[i] = elem->nd[i]->y - y[0];
-  }
+  // element geometry at Gauss points: weight and global derivatives (GRID::Geometry)
 
-  x[0] = y[0] = 0.0;
+  double  local[kMaxGeom];
+  double* geom = project->M2D->region->Geometry( elem, local );
+  int     size = GEOM::Size( nnd, ncn );
 
 
   // -------------------------------------------------------------------------------------
@@ -428,52 +782,21 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
   for( int g=0; g<ngp; g++ ) // START of loop over all GAUSS point
   {
-    // -----------------------------------------------------------------------------------
-    // form JACOBIAN transformation matrix with quadratic shape functions
-
-    double* dfdxPtr = qShape->dfdx[g];
-    double* dfdyPtr = qShape->dfdy[g];
+    double  weight = geom[0];
 
-    double trafo[2][2];
+    double* dndx   = geom + 1;             // quadratic shape functions at GP g
+    double* dndy   = dndx + nnd;
+    double* n      = qShape->f[g];
 
-    double detj = qShape->jacobi2D( nnd, dfdxPtr, dfdyPtr, x, y, trafo );
+    double* dmdx   = dndy + nnd;           // linear shape functions at GP g
+    double* dmdy   = dmdx + ncn;
+    double* m      = lShape->f[g];
 
-    double weight = detj * qShape->weight[g];
+    geom += size;
 
     area += weight;
 
 
-    // -------------------------------------------------------------------------------------
-    // compute values of quadratic shape functions at GP g
-
-    double dndx[kMaxNodes2D], dndy[kMaxNodes2D];
-
-    double* n = qShape->f[g];
-
-    for( int j=0; j<nnd; j++ )
-    {
-      dndx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
-      dndy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
-    }
-
-
-    // ------------------------------------------------------------------------------------
-    // compute values of linear shape functions at GP g
-
-    dfdxPtr = lShape->dfdx[g];
-    dfdyPtr = lShape->dfdy[g];
-
-    double dmdx[kMaxNodes2D], dmdy[kMaxNodes2D];
-
-    double* m = lShape->f[g];
-
-    for( int j=0; j<ncn; j++ )
-    {
-      dmdx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
-      dmdy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
-    }
-
-
     // ------------------------------------------------------------------------------------
     // compute flow parameters and their derivatives at GP g
     //             horizontal velocities: U and V
@@ -483,19 +806,9 @@ void EQS_UVS2D::Region( ELEM*    elem,
     //             eddy viscosity       : vt, cf
     //             Reynolds stresses    : uu, uv, and vv
 
-    // integrate H, a and cf with linear shape
-
-    double H    = 0.0;
-    double dHdt = 0.0;
-    double dHdx = 0.0;
-    double dHdy = 0.0;
-
-    double dadx = 0.0;
-    double dady = 0.0;
-
-    double cf   = 0.0;
+    UVSGP<1> gp = {};
 
-    double SS   = 0.0;
+    // integrate H, a and cf with linear shape
 
     for( int j=0; j<ncn; j++ )
     {
@@ -528,18 +841,18 @@ void EQS_UVS2D::Region( ELEM*    elem,
       }
       // ---------------------------------------------------------------------------------
 
-      H    +=    m[j] * ndH;
-      dHdx += dmdx[j] * ndH;
-      dHdy += dmdy[j] * ndH;
+      gp.H[0]    +=    m[j] * ndH;
+      gp.dHdx[0] += dmdx[j] * ndH;
+      gp.dHdy[0] += dmdy[j] * ndH;
 
-      dadx += dmdx[j] * ndZ;
-      dady += dmdy[j] * ndZ;
+      gp.dadx[0] += dmdx[j] * ndZ;
+      gp.dady[0] += dmdy[j] * ndZ;
 
-      dHdt +=    m[j] * node->v.dSdt;
+      gp.dHdt[0] +=    m[j] * node->v.dSdt;
 
-      cf   +=    m[j] * node->cf;
+      gp.cf[0]   +=    m[j] * node->cf;
 
-      SS   +=    m[j] * ndSS;            // Source or Sink
+      gp.SS[0]   +=    m[j] * ndSS;            // Source or Sink
     }
 
 //  if( H <= 0.0 )  H = project->hmin;
@@ -547,20 +860,6 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
     // integrate U, V, uu, uv and vv with quadratic shape
 
-    double U    = 0.0;
-    double dUdt = 0.0;
-    double dUdx = 0.0;
-    double dUdy = 0.0;
-
-    double V    = 0.0;
-    double dVdt = 0.0;
-    double dVdx = 0.0;
-    double dVdy = 0.0;
-
-    double uu   = 0.0;
-    double uv   = 0.0;
-    double vv   = 0.0;
-
     for( int j=0; j<nnd; j++ )
     {
       NODE* node = elem->nd[j];
@@ -568,176 +867,95 @@ void EQS_UVS2D::Region( ELEM*    elem,
       double ndU = node->v.U;
       double ndV = node->v.V;
 
-      U     +=    n[j] * ndU;
-      dUdt  +=    n[j] * node->v.dUdt;
-      dUdx  += dndx[j] * ndU;
-      dUdy  += dndy[j] * ndU;
+      gp.U[0]    +=    n[j] * ndU;
+      gp.dUdt[0] +=    n[j] * node->v.dUdt;
+      gp.dUdx[0] += dndx[j] * ndU;
+      gp.dUdy[0] += dndy[j] * ndU;
 
-      V     +=    n[j] * ndV;
-      dVdt  +=    n[j] * node->v.dVdt;
-      dVdx  += dndx[j] * ndV;
-      dVdy  += dndy[j] * ndV;
+      gp.V[0]    +=    n[j] * ndV;
+      gp.dVdt[0] +=    n[j] * node->v.dVdt;
+      gp.dVdx[0] += dndx[j] * ndV;
+      gp.dVdy[0] += dndy[j] * ndV;
 
-      uu    +=    n[j] * node->uu;
-      uv    +=    n[j] * node->uv;
-      vv    +=    n[j] * node->vv;
+      gp.uu[0]   +=    n[j] * node->uu;
+      gp.uv[0]   +=    n[j] * node->uv;
+      gp.vv[0]   +=    n[j] * node->vv;
     }
 
 
     // compute dispersion coefficients ---------------------------------------------------
 
-    double Dxx = 0.0;
-    double Dxy = 0.0;
-    double Dyy = 0.0;
-
     if( project->actualDisp > 0 )
     {
       for( int j=0; j<nnd; j++ )
       {
         NODE* node = elem->nd[j];
-        Dxx += n[j] * node->Dxx;
-        Dxy += n[j] * node->Dxy;
-        Dyy += n[j] * node->Dyy;
+        gp.Dxx[0] += n[j] * node->Dxx;
+        gp.Dxy[0] += n[j] * node->Dxy;
+        gp.Dyy[0] += n[j] * node->Dyy;
       }
     }
 
 
     // compute eddy viscosity ------------------------------------------------------------
 
-    double vt = 0.0;
-
     if( isFS(project->actualTurb, BCONSET::kVtConstant) )
     {
-      vt = type->vt;
+      gp.vt[0] = type->vt;
     }
     else
     {
-      for( int j=0; j<nnd; j++ )  vt += n[j] * elem->nd[j]->vt;
+      for( int j=0; j<nnd; j++ )  gp.vt[0] += n[j] * elem->nd[j]->vt;
     }
 
     if( isFS(project->actualTurb, BCONSET::kVtMin) )
     {
-      if( vt < type->vt )  vt = type->vt;
+      if( gp.vt[0] < type->vt )  gp.vt[0] = type->vt;
     }
 
 
     // add kinematic viscosity to eddy viscosity  ----------------------------------------
 
-    vt += project->vk;
+    gp.vt[0] += project->vk;
 
 
     // -----------------------------------------------------------------------------------
     // compute UVH-equation and coefficients of NEWTON-RAPHSON matrix
 
-    double  Ures = sqrt( U*U + V*V );          // absolute velocity
-
-
     if( force )
     {
-      double  f, fx, fy;
+      double  f[3][1], fx[2][1], fy[2][1];
       double* forcePtr;
 
-      // ---------------------------------------------------------------------------------
-      // compute x-momentum equation
+      UVSForce( gp, gravity, &weight, f, fx, fy );
 
-      f   =  H * dUdt;                                 // time
-      f  +=  H * (U * dUdx  +  V * dUdy);              // convection
-      fx  =  0.0;
-      fy  =  0.0;
+      // x-momentum equation -------------------------------------------------------------
 
-      fx +=   H * vt * (dUdx + dUdx);                   // eddy viscosity
-      fy +=   H * vt * (dUdy + dVdx);
+      forcePtr = force;
 
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // fx +=  vt * (U * dHdx + U * dHdx);
-      // fy +=  vt * (U * dHdy + V * dHdx);
-      // -------------------------------------------------------------------------------------------
+      for( int j=0; j<nnd; j++ )
+      {
+        forcePtr[j] -= n[j] * f[0][0]  +  dndx[j] * fx[0][0]  +  dndy[j] * fy[0][0];
+      }
 
-      fx -=  H * uu;                                    // turbulence
-      fy -=  H * uv;
-
-      f  +=  H * gravity * dadx;                        // gravity
-      fx -=  H * H * gravity / 2.0;
-
-      f  +=  cf * Ures * U;                             // bottom friction
-
-      // ------------------------------------------------ dispersion
-      // fx += H * Duu;
-      // fy += H * Duv;
-
-      fx +=  H * ( U*U*Dxx - 2.0*U*V*Dxy + V*V*Dyy );
-      fy +=  H * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
-
-      f  *= weight;
-      fx *= weight;
-      fy *= weight;
-
-      forcePtr = force;
-
-      for( int j=0; j<nnd; j++ )
-      {
-        forcePtr[j] -= n[j] * f  +  dndx[j] * fx  +  dndy[j] * fy;
-      }
-
-
-      // ---------------------------------------------------------------------------------
-      // compute y-momentum equation
-
-      f   =  H * dVdt;                                  // time
-      f  +=  H * (U * dVdx  +  V * dVdy);               // convection
-      fx  =  0.0;
-      fy  =  0.0;
-
-      fx +=  H * vt * (dVdx + dUdy);                    // eddy viscosity
-      fy +=  H * vt * (dVdy + dVdy);
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // fx +=  vt * (V * dHdx + U * dHdy);
-      // fy +=  vt * (V * dHdy + V * dHdy);
-      // -------------------------------------------------------------------------------------------
-
-      fx -=  H * uv;                                    // turbulence
-      fy -=  H * vv;
-
-      f  +=  H * gravity * dady;                        // gravity
-      fy -=  H * H * gravity / 2.0;
-
-      f  +=  cf * Ures * V;                             // bottom friction
-
-      // ------------------------------------------------ dispersion
-      // fx += H * Duv;
-      // fy += H * Dvv;
-
-      fx +=  H * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
-      fy +=  H * ( V*V*Dxx + 2.0*U*V*Dxy + U*U*Dyy );
 
-      f  *= weight;
-      fx *= weight;
-      fy *= weight;
+      // y-momentum equation -------------------------------------------------------------
 
       forcePtr = force + startV;
 
       for( int j=0; j<nnd; j++ )
       {
-        forcePtr[j] -= n[j] * f  +  dndx[j] * fx  +  dndy[j] * fy;
+        forcePtr[j] -= n[j] * f[1][0]  +  dndx[j] * fx[1][0]  +  dndy[j] * fy[1][0];
       }
 
 
-      // ---------------------------------------------------------------------------------
-      // compute continuity equation (solve only for corner nodes)
-
-      f  = dHdt  +  H * (dUdx + dVdy)  +  U * dHdx  +  V * dHdy;
-
-      f *= weight;
-      f += SS * weight;   // Source or Sink
+      // continuity equation (corner nodes) ----------------------------------------------
 
       forcePtr = force + startS;
 
       for( int j=0; j<ncn; j++ )
       {
-        forcePtr[j] -= m[j] * f;
+        forcePtr[j] -= m[j] * f[2][0];
       }
     }
 
@@ -745,46 +963,19 @@ void EQS_UVS2D::Region( ELEM*    elem,
     if( estifm )
     {
       double  t[kMaxNodes2D], tx[kMaxNodes2D], ty[kMaxNodes2D];
-      double  df__, df_x, df_y, dfx_, dfxx, dfxy, dfy_, dfyx, dfyy;
       double* estifmPtr;
+      UVSDF<1> d[9];
 
-      // ---------------------------------------------------------------------------------
-      // compute components of NEWTON-RAPHSON Jacobi matrix
-
-      double iUres;
-
-      if( Ures > 1.0e-9 ) iUres = 1.0 / Ures;
-      else                iUres = 0.0;
+      UVSJacobi( gp, gravity, &weight, &relaxThdt_UV, &relaxThdt_H, d );
 
 
       // U-derivative of x-momentum ------------------------------------------------------
 
-      df__  =  weight * H * relaxThdt_UV;
-      df__ +=  weight * H * dUdx;
-      df_x  =  weight * H * U;
-      df_y  =  weight * H * V;
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfxx  =  weight * H * vt * 2.0;
-      dfyy  =  weight * H * vt;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfx_ +=  weight * vt * dHdx * 2.0;
-      // dfy_ +=  weight * vt * dHdy;
-      // -------------------------------------------------------------------------------------------
-
-      df__ +=  weight * cf * (iUres * U*U  +  Ures);
-
-      dfx_ +=  weight * H * ( 2.0*U*Dxx - 2.0*V*Dxy );
-      dfy_ +=  weight * H * ( V*(Dxx-Dyy) + 2.0*U*Dxy );
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j]  = df__ * n[j]  +  df_x * dndx[j]  +  df_y * dndy[j];
-        tx[j] = dfx_ * n[j]  +  dfxx * dndx[j];
-        ty[j] = dfy_ * n[j]                     +  dfyy * dndy[j];
+        t[j]  = d[0].df__[0] * n[j]  +  d[0].df_x[0] * dndx[j]  +  d[0].df_y[0] * dndy[j];
+        tx[j] = d[0].dfx_[0] * n[j]  +  d[0].dfxx[0] * dndx[j];
+        ty[j] = d[0].dfy_[0] * n[j]                          +  d[0].dfyy[0] * dndy[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -800,27 +991,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // V-derivative of x-momentum ------------------------------------------------------
 
-      df__  =  weight * H * dUdy;
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfyx  =  weight * H * vt;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfy_ +=  weight * vt * dHdx;
-      // -------------------------------------------------------------------------------------------
-
-      df__ +=  weight * cf * iUres * U * V;
-
-      dfx_ +=  weight * H * ( 2.0*V*Dyy - 2.0*V*Dxy );
-      dfy_ +=  weight * H * ( V*(Dxx-Dyy) - 2.0*V*Dxy );
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j]  = df__ * n[j];
-        tx[j] = dfx_ * n[j];
-        ty[j] = dfy_ * n[j]  +  dfyx * dndx[j];
+        t[j]  = d[1].df__[0] * n[j];
+        tx[j] = d[1].dfx_[0] * n[j];
+        ty[j] = d[1].dfy_[0] * n[j]  +  d[1].dfyx[0] * dndx[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -836,35 +1011,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // H-derivative of x-momentum ------------------------------------------------------
 
-      df__  =  weight * dUdt;
-      df__ +=  weight * (U * dUdx + V * dUdy);
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfx_ +=  weight * vt * (dUdx + dUdx);
-      dfy_ +=  weight * vt * (dUdy + dVdx);
-
-      dfx_ -=  weight * uu;
-      dfy_ -=  weight * uv;
-
-      df__ +=  weight * gravity * dadx;
-      dfx_ -=  weight * gravity * H;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfxx  =  weight * vt * U * 2.0;
-      // dfyx  =  weight * vt * V;
-      // dfyy  =  weight * vt * U;
-      // -------------------------------------------------------------------------------------------
-
-      dfx_ +=  weight * ( U*U*Dxx - 2.0*U*V*Dxy + V*V*Dyy );
-      dfy_ +=  weight * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
-
       for( int j=0; j<ncn; j++ )
       {
-        t[j]  = df__ * m[j];
-        tx[j] = dfx_ * m[j];
-        ty[j] = dfy_ * m[j];
+        t[j]  = d[2].df__[0] * m[j];
+        tx[j] = d[2].dfx_[0] * m[j];
+        ty[j] = d[2].dfy_[0] * m[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -880,27 +1031,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // U-derivative of y-momentum ------------------------------------------------------
 
-      df__  =  weight * H * dVdx;
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfxy  =  weight * H * vt;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfx_ +=  weight * vt * dHdy;
-      // -------------------------------------------------------------------------------------------
-
-      df__ +=  weight * cf * iUres * U * V;
-
-      dfx_ +=  weight * H * ( V*(Dxx-Dyy) + 2.0*U*Dxy );
-      dfy_ +=  weight * H * ( 2.0*V*Dxy + 2.0*U*Dyy );
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j]  = df__ * n[j];
-        tx[j] = dfx_ * n[j]  +  dfxy * dndy[j];
-        ty[j] = dfy_ * n[j];
+        t[j]  = d[3].df__[0] * n[j];
+        tx[j] = d[3].dfx_[0] * n[j]  +  d[3].dfxy[0] * dndy[j];
+        ty[j] = d[3].dfy_[0] * n[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -916,32 +1051,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // V-derivative of y-momentum ------------------------------------------------------
 
-      df__  =  weight * H * relaxThdt_UV;
-      df__ +=  weight * H * dVdy;
-      df_x  =  weight * H * U;
-      df_y  =  weight * H * V;
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfxx  =  weight * H * vt;
-      dfyy  =  weight * H * vt * 2.0;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfx_ +=  weight * vt * dHdx;
-      // dfy_ +=  weight * vt * dHdy * 2.0;
-      // -------------------------------------------------------------------------------------------
-
-      df__ +=  weight * cf * (iUres * V*V  +  Ures);
-
-      dfx_ +=  weight * H * ( U*(Dxx-Dyy) - 2.0*V*Dxy );
-      dfy_ +=  weight * H * ( 2.0*V*Dxx + 2.0*U*Dxy );
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j]  = df__ * n[j]  +  df_x * dndx[j]  +  df_y * dndy[j];
-        tx[j] = dfx_ * n[j]  +  dfxx * dndx[j];
-        ty[j] = dfy_ * n[j]  +  dfyy * dndy[j];
+        t[j]  = d[4].df__[0] * n[j]  +  d[4].df_x[0] * dndx[j]  +  d[4].df_y[0] * dndy[j];
+        tx[j] = d[4].dfx_[0] * n[j]  +  d[4].dfxx[0] * dndx[j];
+        ty[j] = d[4].dfy_[0] * n[j]  +  d[4].dfyy[0] * dndy[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -957,35 +1071,11 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // H-derivative of y-momentum ------------------------------------------------------
 
-      df__  =  weight * dVdt;
-      df__ +=  weight * (U * dVdx + V * dVdy);
-      dfx_  =  0.0;
-      dfy_  =  0.0;
-
-      dfx_ +=  weight * vt * (dVdx + dUdy);
-      dfy_ +=  weight * vt * (dVdy + dVdy);
-
-      dfx_ -=  weight * uv;
-      dfy_ -=  weight * vv;
-
-      df__ +=  weight * gravity * dady;
-      dfy_ -=  weight * gravity * H;
-
-      // -------------------------------------------------------------------------------------------
-      // The following depth-averaged Boussinesq approach leads to instabilities in LES.
-      // dfxx  =  weight * vt * V;
-      // dfxy  =  weight * vt * U;
-      // dfyy  =  weight * vt * V * 2.0;
-      // -------------------------------------------------------------------------------------------
-
-      dfx_ +=  weight * ( U*V*(Dxx-Dyy) + (U*U-V*V)*Dxy );
-      dfy_ +=  weight * ( V*V*Dxx + 2.0*U*V*Dxy + U*U*Dyy );
-
       for( int j=0; j<ncn; j++ )
       {
-        t[j]  = df__ * m[j];
-        tx[j] = dfx_ * m[j];
-        ty[j] = dfy_ * m[j];
+        t[j]  = d[5].df__[0] * m[j];
+        tx[j] = d[5].dfx_[0] * m[j];
+        ty[j] = d[5].dfy_[0] * m[j];
       }
 
       for( int j=0; j<nnd; j++ )
@@ -1001,12 +1091,9 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // U-derivative of continuity ------------------------------------------------------
 
-      df__ = weight * dHdx;
-      df_x = weight * H;
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j] = df__ * n[j]  +  df_x * dndx[j];
+        t[j] = d[6].df__[0] * n[j]  +  d[6].df_x[0] * dndx[j];
       }
 
       for( int j=0; j<ncn; j++ )
@@ -1022,12 +1109,9 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // V-derivative of continuity ------------------------------------------------------
 
-      df__ = weight * dHdy;
-      df_y = weight * H;
-
       for( int j=0; j<nnd; j++ )
       {
-        t[j] = df__ * n[j] + df_y * dndy[j];
+        t[j] = d[7].df__[0] * n[j] + d[7].df_y[0] * dndy[j];
       }
 
       for( int j=0; j<ncn; j++ )
@@ -1043,14 +1127,9 @@ void EQS_UVS2D::Region( ELEM*    elem,
 
       // H-derivative of continuity ------------------------------------------------------
 
-      df__  = weight * relaxThdt_H;
-      df__ += weight * (dUdx + dVdy);
-      df_x  = weight * U;
-      df_y  = weight * V;
-
       for( int j=0; j<ncn; j++ )
       {
-        t[j] = df__ * m[j]  +  df_x * dmdx[j]  +  df_y * dmdy[j];
+        t[j] = d[8].df__[0] * m[j]  +  d[8].df_x[0] * dmdx[j]  +  d[8].df_y[0] * dmdy[j];
       }
 
       for( int j=0; j<ncn; j++ )
@@ -1072,6 +1151,27 @@ void EQS_UVS2D::Region( ELEM*    elem,
   Rotate2D( nnd, elem->nd, 3, estifm, force );
 
 
+  // insert experimental upstream boundary forces ------------------------------------------------
+
+  Inflow( elem, project, area, estifm, force );
+}
+
+
+// ======================================================================================
+
+void EQS_UVS2D::Inflow( ELEM*    elem,
+                        PROJECT* project,
+                        double   area,
+                        double** estifm,
+                        double*  force )
+{
+  SHAPE* qShape = elem->GetQShape();
+
+  int nnd    = qShape->nnd;
+  int ncn    = elem->GetLShape()->nnd;
+  int startS = 2 * nnd;
+
+
   // -----------------------------------------------------------------------------------------------
   // insert experimental upstream boundary forces at nodes with inflow
   // boundary condition  (qfix = constant):
@@ -1190,6 +1290,609 @@ void EQS_UVS2D::Region( ELEM*    elem,
 }
 
 
+// ======================================================================================
+// Region elements may be computed in batches of kBatch elements with the same shape.
+
+int EQS_UVS2D::Batched( ELEM* elem )
+{
+  if( !batchCoefs )                      return false;
+  if( isFS(elem->flag, ELEM::kDry) )     return false;
+  if( isFS(elem->flag, ELEM::kBound) )   return false;
+
+  return true;
+}
+
+
+void EQS_UVS2D::CoefsBatch( int       nb,
+                            ELEM**    elem,
+                            PROJECT*  project,
+                            double*** estifm,
+                            double**  force )
+{
+  switch( elem[0]->GetQShape()->nnd )
+  {
+    case 6:  RegionBatch<6,3>( nb, elem, project, estifm, force );  break;
+    case 8:  RegionBatch<8,4>( nb, elem, project, estifm, force );  break;
+
+    default:
+      EQS::CoefsBatch( nb, elem, project, estifm, force );
+      break;
+  }
+}
+
+
+// ======================================================================================
+// RegionBatch() computes the same coefficients as Region() for nb <= kBatch elements of
+// equal shape at once. Node values and element geometry are gathered into arrays with
+// the element (lane) as innermost index, so that the loops over lanes may be executed
+// with SIMD instructions. The state at GAUSS points is a structure of arrays UVSGP<kBatch>
+// and the terms of the equations are computed for all lanes with the same functions
+// UVSForce() and UVSJacobi() as in Region(), the results are identical.
+// Unused lanes of an incomplete batch are filled with the last element.
+
+template< int kNnd, int kNcn >
+void EQS_UVS2D::RegionBatch( int       nb,
+                             ELEM**    elem,
+                             PROJECT*  project,
+                             double*** estifm,
+                             double**  force )
+{
+  // -------------------------------------------------------------------------------------
+  // initializations
+
+  const int nl  = kBatch;        // number of lanes
+  const int nnd = kNnd;          // number of nodes in all
+  const int ncn = kNcn;          // number of corner nodes
+  const int neq = 2*kNnd + kNcn; // number of element equations
+
+  const int startV = nnd;
+  const int startS = 2 * nnd;
+
+  ELEM* el[kBatch];
+
+  for( int b=0; b<nl; b++ )  el[b] = elem[(b < nb)? b : nb-1];
+
+  SHAPE* lShape = el[0]->GetLShape();
+  SHAPE* qShape = el[0]->GetQShape();
+
+  int ngp = qShape->ngp;         // number of GAUSS points
+
+  double gravity = project->g;
+  double hmin    = project->hmin;
+  double vk      = project->vk;
+  double rdtUV[kBatch], rdtH[kBatch];
+
+  for( int b=0; b<kBatch; b++ )
+  {
+    double fac = ( localFac )? localFac[el[b]->Getno()] : 1.0;
+
+    rdtUV[b] = relaxThdt_UV * fac;
+    rdtH[b]  = relaxThdt_H  * fac;
+  }
+
+  int    disp    = project->actualDisp > 0;
+  int    vtConst = isFS(project->actualTurb, BCONSET::kVtConstant);
+  int    vtMin   = isFS(project->actualTurb, BCONSET::kVtMin);
+
+  // -------------------------------------------------------------------------------------
+  // gather node values of the batch
+
+  double ndU[kNnd][kBatch],   ndV[kNnd][kBatch];
+  double ndUt[kNnd][kBatch],  ndVt[kNnd][kBatch];
+  double nduu[kNnd][kBatch],  nduv[kNnd][kBatch],  ndvv[kNnd][kBatch];
+  double ndvt[kNnd][kBatch];
+  double ndDxx[kNnd][kBatch], ndDxy[kNnd][kBatch], ndDyy[kNnd][kBatch];
+
+  double ndH[kNcn][kBatch],   ndZ[kNcn][kBatch],   ndSt[kNcn][kBatch];
+  double ndcf[kNcn][kBatch],  ndSS[kNcn][kBatch];
+
+  double typeVt[kBatch];
+
+  for( int b=0; b<nl; b++ )
+  {
+    typeVt[b] = TYPE::Getid( el[b]->type )->vt;
+
+    for( int j=0; j<nnd; j++ )
+    {
+      NODE* node = el[b]->nd[j];
+
+      ndU[j][b]   = node->v.U;
+      ndV[j][b]   = node->v.V;
+      ndUt[j][b]  = node->v.dUdt;
+      ndVt[j][b]  = node->v.dVdt;
+      nduu[j][b]  = node->uu;
+      nduv[j][b]  = node->uv;
+      ndvv[j][b]  = node->vv;
+      ndvt[j][b]  = node->vt;
+      ndDxx[j][b] = node->Dxx;
+      ndDxy[j][b] = node->Dxy;
+      ndDyy[j][b] = node->Dyy;
+    }
+
+    for( int j=0; j<ncn; j++ )
+    {
+      NODE* node = el[b]->nd[j];
+      BCON* bcon = &node->bc;
+
+      double z = node->z;
+      double H = node->v.S - z;
+
+      if( H <= 0.0 )  H = hmin;
+
+      ndZ[j][b]  = z;
+      ndH[j][b]  = H;
+      ndSt[j][b] = node->v.dSdt;
+      ndcf[j][b] = node->cf;
+
+      if( isFS(bcon->kind, BCON::kSource) )   // Source or Sink (see Region)
+      {
+        ndSS[j][b] = -bcon->val->Q * ncn / bcon->val->A;
+      }
+      else
+      {
+        ndSS[j][b] = 0.0;
+      }
+    }
+  }
+
+
+  // -------------------------------------------------------------------------------------
+  // gather element geometry at Gauss points (GRID::Geometry)
+
+  double gw[kMaxGP2D][kBatch];
+  double gnx[kMaxGP2D][kNnd][kBatch], gny[kMaxGP2D][kNnd][kBatch];
+  double gmx[kMaxGP2D][kNcn][kBatch], gmy[kMaxGP2D][kNcn][kBatch];
+
+  int size = GEOM::Size( nnd, ncn );
+
+  double local[kMaxGeom];
+
+  for( int b=0; b<nl; b++ )
+  {
+    double* geom = project->M2D->region->Geometry( el[b], local );
+
+    for( int g=0; g<ngp; g++ )
+    {
+      gw[g][b] = geom[0];
+
+      for( int j=0; j<nnd; j++ )
+      {
+        gnx[g][j][b] = geom[1 + j];
+        gny[g][j][b] = geom[1 + nnd + j];
+      }
+
+      for( int j=0; j<ncn; j++ )
+      {
+        gmx[g][j][b] = geom[1 + 2*nnd + j];
+        gmy[g][j][b] = geom[1 + 2*nnd + ncn + j];
+      }
+
+      geom += size;
+    }
+  }
+
+
+  // -------------------------------------------------------------------------------------
+  // batch of element vectors and matrices
+
+  double frc[neq][kBatch];
+  double stf[neq][neq][kBatch];
+  double area[kBatch];
+
+  for( int i=0; i<neq; i++ )
+  {
+    for( int b=0; b<nl; b++ )  frc[i][b] = 0.0;
+
+    for( int j=0; j<neq; j++ )
+    {
+      for( int b=0; b<nl; b++ )  stf[i][j][b] = 0.0;
+    }
+  }
+
+  for( int b=0; b<nl; b++ )  area[b] = 0.0;
+
+
+  // -------------------------------------------------------------------------------------
+  // use GAUSS point integration to solve momentum equations for x- and
+  // y-direction (U and V) and continuity equation (H)
+
+  for( int g=0; g<ngp; g++ ) // START of loop over all GAUSS point
+  {
+    double* weight = gw[g];
+
+    double  (*dndx)[kBatch] = gnx[g];      // quadratic shape functions at GP g
+    double  (*dndy)[kBatch] = gny[g];
+    double* n               = qShape->f[g];
+
+    double  (*dmdx)[kBatch] = gmx[g];      // linear shape functions at GP g
+    double  (*dmdy)[kBatch] = gmy[g];
+    double* m               = lShape->f[g];
+
+    for( int b=0; b<nl; b++ )  area[b] += weight[b];
+
+
+    // -----------------------------------------------------------------------------------
+    // integrate H, a and cf with linear shape
+
+    UVSGP<kBatch> gp;
+
+    for( int b=0; b<nl; b++ )
+    {
+      gp.H[b]    = 0.0;
+      gp.dHdt[b] = 0.0;
+      gp.dHdx[b] = 0.0;
+      gp.dHdy[b] = 0.0;
+      gp.dadx[b] = 0.0;
+      gp.dady[b] = 0.0;
+      gp.cf[b]   = 0.0;
+      gp.SS[b]   = 0.0;
+    }
+
+    for( int j=0; j<ncn; j++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        gp.H[b]    +=       m[j] * ndH[j][b];
+        gp.dHdx[b] += dmdx[j][b] * ndH[j][b];
+        gp.dHdy[b] += dmdy[j][b] * ndH[j][b];
+
+        gp.dadx[b] += dmdx[j][b] * ndZ[j][b];
+        gp.dady[b] += dmdy[j][b] * ndZ[j][b];
+
+        gp.dHdt[b] +=       m[j] * ndSt[j][b];
+
+        gp.cf[b]   +=       m[j] * ndcf[j][b];
+
+        gp.SS[b]   +=       m[j] * ndSS[j][b];
+      }
+    }
+
+
+    // integrate U, V, uu, uv and vv with quadratic shape --------------------------------
+
+    for( int b=0; b<nl; b++ )
+    {
+      gp.U[b]  = gp.dUdt[b] = gp.dUdx[b] = gp.dUdy[b] = 0.0;
+      gp.V[b]  = gp.dVdt[b] = gp.dVdx[b] = gp.dVdy[b] = 0.0;
+      gp.uu[b] = gp.uv[b]   = gp.vv[b]   = 0.0;
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        gp.U[b]    +=       n[j] * ndU[j][b];
+        gp.dUdt[b] +=       n[j] * ndUt[j][b];
+        gp.dUdx[b] += dndx[j][b] * ndU[j][b];
+        gp.dUdy[b] += dndy[j][b] * ndU[j][b];
+
+        gp.V[b]    +=       n[j] * ndV[j][b];
+        gp.dVdt[b] +=       n[j] * ndVt[j][b];
+        gp.dVdx[b] += dndx[j][b] * ndV[j][b];
+        gp.dVdy[b] += dndy[j][b] * ndV[j][b];
+
+        gp.uu[b]   +=       n[j] * nduu[j][b];
+        gp.uv[b]   +=       n[j] * nduv[j][b];
+        gp.vv[b]   +=       n[j] * ndvv[j][b];
+      }
+    }
+
+
+    // compute dispersion coefficients ---------------------------------------------------
+
+    for( int b=0; b<nl; b++ )  gp.Dxx[b] = gp.Dxy[b] = gp.Dyy[b] = 0.0;
+
+    if( disp )
+    {
+      for( int j=0; j<nnd; j++ )
+      {
+        for( int b=0; b<nl; b++ )
+        {
+          gp.Dxx[b] += n[j] * ndDxx[j][b];
+          gp.Dxy[b] += n[j] * ndDxy[j][b];
+          gp.Dyy[b] += n[j] * ndDyy[j][b];
+        }
+      }
+    }
+
+
+    // compute eddy viscosity and add kinematic viscosity --------------------------------
+
+    for( int b=0; b<nl; b++ )  gp.vt[b] = 0.0;
+
+    if( vtConst )
+    {
+      for( int b=0; b<nl; b++ )  gp.vt[b] = typeVt[b];
+    }
+    else
+    {
+      for( int j=0; j<nnd; j++ )
+      {
+        for( int b=0; b<nl; b++ )  gp.vt[b] += n[j] * ndvt[j][b];
+      }
+    }
+
+    if( vtMin )
+    {
+      for( int b=0; b<nl; b++ )  if( gp.vt[b] < typeVt[b] )  gp.vt[b] = typeVt[b];
+    }
+
+    for( int b=0; b<nl; b++ )  gp.vt[b] += vk;
+
+
+    // -----------------------------------------------------------------------------------
+    // compute UVH-equation
+
+    {
+      double f[3][kBatch], fx[2][kBatch], fy[2][kBatch];
+
+      UVSForce( gp, gravity, weight, f, fx, fy );
+
+      // x-momentum equation -------------------------------------------------------------
+
+      for( int j=0; j<nnd; j++ )
+      {
+        for( int b=0; b<nl; b++ )
+          frc[j][b] -= n[j] * f[0][b]  +  dndx[j][b] * fx[0][b]  +  dndy[j][b] * fy[0][b];
+      }
+
+
+      // y-momentum equation -------------------------------------------------------------
+
+      for( int j=0; j<nnd; j++ )
+      {
+        for( int b=0; b<nl; b++ )
+          frc[startV+j][b] -= n[j] * f[1][b]  +  dndx[j][b] * fx[1][b]  +  dndy[j][b] * fy[1][b];
+      }
+
+
+      // continuity equation (corner nodes) ----------------------------------------------
+
+      for( int j=0; j<ncn; j++ )
+      {
+        for( int b=0; b<nl; b++ )  frc[startS+j][b] -= m[j] * f[2][b];
+      }
+    }
+
+
+    // -----------------------------------------------------------------------------------
+    // compute components of NEWTON-RAPHSON Jacobi matrix
+
+    double t[kNnd][kBatch], tx[kNnd][kBatch], ty[kNnd][kBatch];
+    UVSDF<kBatch>  d[9];
+    UVSDF<kBatch>* df;
+
+    UVSJacobi( gp, gravity, weight, rdtUV, rdtH, d );
+
+
+    // U-derivative of x-momentum --------------------------------------------------------
+
+    df = &d[0];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * n[k]  +  df->df_x[b] * dndx[k][b]  +  df->df_y[b] * dndy[k][b];
+        tx[k][b] = df->dfx_[b] * n[k]  +  df->dfxx[b] * dndx[k][b];
+        ty[k][b] = df->dfy_[b] * n[k]                               +  df->dfyy[b] * dndy[k][b];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[j][k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // V-derivative of x-momentum --------------------------------------------------------
+
+    df = &d[1];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * n[k];
+        tx[k][b] = df->dfx_[b] * n[k];
+        ty[k][b] = df->dfy_[b] * n[k]  +  df->dfyx[b] * dndx[k][b];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[j][startV+k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // H-derivative of x-momentum --------------------------------------------------------
+
+    df = &d[2];
+
+    for( int k=0; k<ncn; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * m[k];
+        tx[k][b] = df->dfx_[b] * m[k];
+        ty[k][b] = df->dfy_[b] * m[k];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<ncn; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[j][startS+k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // U-derivative of y-momentum --------------------------------------------------------
+
+    df = &d[3];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * n[k];
+        tx[k][b] = df->dfx_[b] * n[k]  +  df->dfxy[b] * dndy[k][b];
+        ty[k][b] = df->dfy_[b] * n[k];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[startV+j][k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // V-derivative of y-momentum --------------------------------------------------------
+
+    df = &d[4];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * n[k]  +  df->df_x[b] * dndx[k][b]  +  df->df_y[b] * dndy[k][b];
+        tx[k][b] = df->dfx_[b] * n[k]  +  df->dfxx[b] * dndx[k][b];
+        ty[k][b] = df->dfy_[b] * n[k]  +  df->dfyy[b] * dndy[k][b];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[startV+j][startV+k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // H-derivative of y-momentum --------------------------------------------------------
+
+    df = &d[5];
+
+    for( int k=0; k<ncn; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+      {
+        t[k][b]  = df->df__[b] * m[k];
+        tx[k][b] = df->dfx_[b] * m[k];
+        ty[k][b] = df->dfy_[b] * m[k];
+      }
+    }
+
+    for( int j=0; j<nnd; j++ )
+    {
+      for( int k=0; k<ncn; k++ )
+      {
+        for( int b=0; b<nl; b++ )
+          stf[startV+j][startS+k][b] += n[j]*t[k][b] + dndx[j][b]*tx[k][b] + dndy[j][b]*ty[k][b];
+      }
+    }
+
+
+    // U-derivative of continuity --------------------------------------------------------
+
+    df = &d[6];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )  t[k][b] = df->df__[b] * n[k]  +  df->df_x[b] * dndx[k][b];
+    }
+
+    for( int j=0; j<ncn; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )  stf[startS+j][k][b] += m[j]*t[k][b];
+      }
+    }
+
+
+    // V-derivative of continuity --------------------------------------------------------
+
+    df = &d[7];
+
+    for( int k=0; k<nnd; k++ )
+    {
+      for( int b=0; b<nl; b++ )  t[k][b] = df->df__[b] * n[k] + df->df_y[b] * dndy[k][b];
+    }
+
+    for( int j=0; j<ncn; j++ )
+    {
+      for( int k=0; k<nnd; k++ )
+      {
+        for( int b=0; b<nl; b++ )  stf[startS+j][startV+k][b] += m[j]*t[k][b];
+      }
+    }
+
+
+    // H-derivative of continuity --------------------------------------------------------
+
+    df = &d[8];
+
+    for( int k=0; k<ncn; k++ )
+    {
+      for( int b=0; b<nl; b++ )
+        t[k][b] = df->df__[b] * m[k]  +  df->df_x[b] * dmdx[k][b]  +  df->df_y[b] * dmdy[k][b];
+    }
+
+    for( int j=0; j<ncn; j++ )
+    {
+      for( int k=0; k<ncn; k++ )
+      {
+        for( int b=0; b<nl; b++ )  stf[startS+j][startS+k][b] += m[j]*t[k][b];
+      }
+    }
+  } // END of loop over all GAUSS points
+
+
+  // -------------------------------------------------------------------------------------
+  // scatter the lanes to the batch of element matrices, apply transformation and
+  // insert experimental upstream boundary forces
+
+  for( int b=0; b<nb; b++ )
+  {
+    double*  fb = force[b];
+    double** eb = estifm[b];
+
+    for( int i=0; i<maxEleq; i++ )
+    {
+      fb[i] = 0.0;
+      for( int j=0; j<maxEleq; j++ )  eb[i][j] = 0.0;
+    }
+
+    for( int i=0; i<neq; i++ )
+    {
+      fb[i] = frc[i][b];
+      for( int j=0; j<neq; j++ )  eb[i][j] = stf[i][j][b];
+    }
+
+    Rotate2D( nnd, el[b]->nd, 3, eb, fb );
+
+    Inflow( el[b], project, area[b], eb, fb );
+  }
+}
+
+
 // ======================================================================================
 
 void EQS_UVS2D::Bound_pinc( ELEM*    elem,
@@ -102,6 +102,7 @@ void PROJECT::Compute()
     case 1:
     case 2:
       scale.scale( this );
+      R2D->geom.Invalidate();                   // coordinates have been scaled
       break;
   }
 
@@ -402,6 +403,28 @@ void PROJECT::Compute()
     timeint.actualBcSet = &timeint.bconSet[bcSetNo];
 
 
+    // morphological acceleration: skip the flow cycles of this time step, if the bed
+    // changed less than SED::skipFlow * SED::maxDz since the last flow solution ---------
+
+    skipFlow = false;
+
+    if( sed.skipFlow > 0.0  &&  bcSetNo == prevBcSetNo )
+    {
+      if( sed.sumDz >= 0.0  &&  sed.sumDz < sed.skipFlow * sed.maxDz )  skipFlow = true;
+    }
+
+    if( skipFlow )
+    {
+      REPORT::rpt.Message( 1, "\n%-25s%s %12.5le\n\n",
+                              " (PROJECT::Compute)",
+                              "flow cycles skipped, change of bed =", sed.sumDz );
+    }
+    else
+    {
+      sed.sumDz = -1.0;
+    }
+
+
     // determine the next iteration cycle ------------------------------------------------
 
     NextCycle( &timeint.bconSet[bcSetNo], true );
@@ -434,320 +457,386 @@ void PROJECT::Compute()
       if( timeint.reset_statist[iTM - 1] )  statist->Reset( M2D );
     }
 
+    // -----------------------------------------------------------------------------------
+    // time increment of first sub step
+
+    if( timeint.adapt )  AdaptStart();
+
+
     // -----------------------------------------------------------------------------------
     // solve equations
 
     for( ;; )
     {
-      switch( theCycle )
+      // ---------------------------------------------------------------------------------
+      // the sediment parameters of the next cycle (SED::Initialize) are computed on a
+      // second core, if they do not depend on data of the actual cycle (Overlap); the
+      // results are the same as in sequential order
+
+      int overlap = false;
+
+#     if defined(_OPENMP)  &&  !defined(_MPI_)
+      if( !sed.Getinit() )
       {
-        // -------------------------------------------------------------------------------
-        // Navier-Stokes cycle
+        overlap = Overlap( theCycle, PeekCycle(&timeint.bconSet[bcSetNo]) );
+      }
+#     endif
 
-        case kUVSCyc:                                                   // 2D: UVS coupled
-          if( isFS(actualTurb, BCONSET::kVtAnisotrop) )
-          {
-            eqs_uvs2d_ai.Execute( this, actualStat );
-          }
-          else
-          {
-            eqs_uvs2d.Execute( this, actualStat );
-          }
-          break;
+#     pragma omp parallel sections num_threads(2) if(overlap)
+      {
+#       pragma omp section
+        {
+          if( overlap )  sed.Initialize( this );
+        }
 
+#       pragma omp section
+        switch( theCycle )
+        {
+          // -----------------------------------------------------------------------------
+          // Navier-Stokes cycle
 
-        case kUVS_TMCyc:                                                // 2D: UVS coupled
-          if( isFS(actualTurb, BCONSET::kVtAnisotrop) )
-          {
-            eqs_uvs2d_tmai.Execute( this, actualStat );
-          }
-          else
-          {
-            eqs_uvs2d_tm.Execute( this, actualStat );
-          }
-          break;
+          case kUVSCyc:                                                   // 2D: UVS coupled
+            if( isFS(actualTurb, BCONSET::kVtAnisotrop) )
+            {
+              eqs_uvs2d_ai.Execute( this, actualStat );
+            }
+            else
+            {
+              eqs_uvs2d.Execute( this, actualStat );
+            }
+            break;
 
 
-        case kUVS_LVCyc:                           // 2D: UVS coupled, linear UV, const. S
-          eqs_uvs2d_lv.Execute( this, actualStat );
-          break;
+          case kUVS_TMCyc:                                                // 2D: UVS coupled
+            if( isFS(actualTurb, BCONSET::kVtAnisotrop) )
+            {
+              eqs_uvs2d_tmai.Execute( this, actualStat );
+            }
+            else
+            {
+              eqs_uvs2d_tm.Execute( this, actualStat );
+            }
+            break;
+
+
+          case kUVS_LVCyc:                           // 2D: UVS coupled, linear UV, const. S
+            eqs_uvs2d_lv.Execute( this, actualStat );
+            break;
 
 /*
-        case kUVS_LVXCyc:
-          eqs_uvs2d_lvx.Execute( this );
-          break;
+          case kUVS_LVXCyc:
+            eqs_uvs2d_lvx.Execute( this );
+            break;
 */
 
-        case kDispCurv2D:
-          eqs_disp.Execute( this );
-          break;
+          case kDispCurv2D:
+            eqs_disp.Execute( this );
+            break;
 
-        // -------------------------------------------------------------------------------
-        // algebraic eddy viscosity model cycles
+          // -----------------------------------------------------------------------------
+          // algebraic eddy viscosity model cycles
 
-        case kKDInitCyc:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kKDInitCyc:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          // compute friction coefficients
-          M2D->DoFriction( this );
+            // compute friction coefficients
+            M2D->DoFriction( this );
 
-          // initialize Reynolds stresses and eddy viscosity
-          R2D->Turbulence( this );
+            // initialize Reynolds stresses and eddy viscosity
+            R2D->Turbulence( this );
 
-          // initialize K and D with algebraic model
-          R2D->InitKD( this );
-          M2D->SetBoundKD( this );
-//        R2D->SmoothKD( smoothPassesKD );
+            // initialize K and D with algebraic model
+            R2D->InitKD( this );
+            M2D->SetBoundKD( this );
+//          R2D->SmoothKD( smoothPassesKD );
 
-          // initialize Reynolds stresses and eddy viscosity (once again)
-          R2D->Turbulence( this );
-          break;
+            // initialize Reynolds stresses and eddy viscosity (once again)
+            R2D->Turbulence( this );
+            break;
 
 
-        // -------------------------------------------------------------------------------
-        // one equation turbulence model cycle
-
-        case kKLCyc:
-#         ifdef _MPI_
-          if( subdom.npr > 1 )
-            REPORT::rpt.Error( kParameterFault, "currently no cycle %d in MPI-Version", theCycle );
-#         endif
-          eqs_kl2d.Execute( this, actualStat );
-//        R2D->smoothKD( smoothPassesKD );
-          break;
+          // -----------------------------------------------------------------------------
+          // one equation turbulence model cycle
 
+          case kKLCyc:
+#           ifdef _MPI_
+            if( subdom.npr > 1 )
+              REPORT::rpt.Error( kParameterFault, "currently no cycle %d in MPI-Version", theCycle );
+#           endif
+            eqs_kl2d.Execute( this, actualStat );
+//          R2D->smoothKD( smoothPassesKD );
+            break;
 
-        // -------------------------------------------------------------------------------
-        // k-epsilon cycle (two equation turbulence cycle)
 
-        case kKDCyc:
-          eqs_kd2d.Execute( this, actualStat, 0 );
-          break;
+          // -----------------------------------------------------------------------------
+          // k-epsilon cycle (two equation turbulence cycle)
 
-        case kKD_LCyc:
-          eqs_kd2d.Execute( this, actualStat, 1 );
-          break;
+          case kKDCyc:
+            eqs_kd2d.Execute( this, actualStat, 0 );
+            break;
 
-        case kKD_QCyc:
-          eqs_kd2d.Execute( this, actualStat, 2 );
-          break;
+          case kKD_LCyc:
+            eqs_kd2d.Execute( this, actualStat, 1 );
+            break;
 
-        // -------------------------------------------------------------------------------
+          case kKD_QCyc:
+            eqs_kd2d.Execute( this, actualStat, 2 );
+            break;
 
-        case kKCyc:
-          eqs_k2d.Execute( this, actualStat, 0 );
-          break;
+          // -----------------------------------------------------------------------------
 
-        // -------------------------------------------------------------------------------
+          case kKCyc:
+            eqs_k2d.Execute( this, actualStat, 0 );
+            break;
 
-        case kDCyc:
-          eqs_d2d.Execute( this, actualStat, 0 );
-          break;
+          // -----------------------------------------------------------------------------
 
-        // -------------------------------------------------------------------------------
-        // suspended and bed load cycles
+          case kDCyc:
+            eqs_d2d.Execute( this, actualStat, 0 );
+            break;
 
-        // sediment transport cycle ------------------------------------------------------
-        case kQbCyc:
-          // initialize sediment parameters as qbe, Ls, sx, sy, ... ----------------------
-          sed.Initialize( this );
+          // -----------------------------------------------------------------------------
+          // suspended and bed load cycles
 
-          eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
+          // sediment transport cycle ----------------------------------------------------
+          case kQbCyc:
+            // initialize sediment parameters as qbe, Ls, sx, sy, ... --------------------
+            if( !sed.Getinit() )  sed.Initialize( this );
 
-          // detach memory for parameters ------------------------------------------------
-          sed.Detach();
-          break;
+            eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
 
-        // suspended load ----------------------------------------------------------------
-        case kSLCyc:
-          // initialize sediment parameters as qbe, Ls, sx, sy, ... ----------------------
-          sed.Initialize( this );
+            // detach memory for parameters ----------------------------------------------
+            sed.Detach();
+            break;
 
-          eqs_sl2d.Execute( this );
-          eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
+          // suspended load --------------------------------------------------------------
+          case kSLCyc:
+            // initialize sediment parameters as qbe, Ls, sx, sy, ... --------------------
+            if( !sed.Getinit() )  sed.Initialize( this );
 
-          // detach memory for parameters ------------------------------------------------
-          sed.Detach();
-          break;
+            eqs_sl2d.Execute( this );
+            eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
 
-        // bed load cycle ----------------------------------------------------------------
-        case kBLCyc:
-          // initialize sediment parameters as qbe, Ls, sx, sy, ... ----------------------
-          sed.Initialize( this );
+            // detach memory for parameters ----------------------------------------------
+            sed.Detach();
+            break;
 
-          eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
-          eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
+          // bed load cycle --------------------------------------------------------------
+          case kBLCyc:
+            // initialize sediment parameters as qbe, Ls, sx, sy, ... --------------------
+            if( !sed.Getinit() )  sed.Initialize( this );
 
-          // detach memory for parameters ------------------------------------------------
-          sed.Detach();
-          break;
+            // bed load and bed evolution in sub steps of the flow time step -------------
+            for( sed.subStep=0; sed.subStep<sed.subSteps; sed.subStep++ )
+            {
+              if( sed.subStep > 0 )                       // parameters for changed bed
+              {
+                sed.Detach();
+                sed.Initialize( this );
+              }
+
+              eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
+              eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
+            }
+
+            sed.subStep = 0;
 
+            // detach memory for parameters ----------------------------------------------
+            sed.Detach();
+            break;
 
-        // bed and suspended load cycle --------------------------------------------------
-        case kBSLCyc:
-          // initialize sediment parameters as qbe, Ls, sx, sy, ... ----------------------
-          sed.Initialize( this );
 
-          eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
-          eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
-          eqs_sl2d.Execute( this );
+          // bed and suspended load cycle ------------------------------------------------
+          case kBSLCyc:
+            // initialize sediment parameters as qbe, Ls, sx, sy, ... --------------------
+            if( !sed.Getinit() )  sed.Initialize( this );
 
-          // detach memory for parameters ------------------------------------------------
-          sed.Detach();
-          break;
+            for( sed.subStep=0; sed.subStep<sed.subSteps; sed.subStep++ )
+            {
+              if( sed.subStep > 0 )                       // parameters for changed bed
+              {
+                sed.Detach();
+                sed.Initialize( this );
+              }
 
+              eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
+              eqs_dz.Execute( this, EQS_BL2D::kQuadratic );
+            }
 
-        // difference in bed load used for bottom evolution ------------------------------
-        case kDiffBLCyc:
-          // initialize sediment parameters as qbe, Ls, sx, sy, ... ----------------------
-          sed.Initialize( this );
+            sed.subStep = 0;
 
-          eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
-          eqs_dz.QbDiff( this, EQS_BL2D::kQuadratic );
+            eqs_sl2d.Execute( this );
 
-          // detach memory for parameters ------------------------------------------------
-          sed.Detach();
-          break;
+            // detach memory for parameters ----------------------------------------------
+            sed.Detach();
+            break;
 
 
-        // -------------------------------------------------------------------------------
-        // divergence free flow field cycle
+          // difference in bed load used for bottom evolution ----------------------------
+          case kDiffBLCyc:
+            // initialize sediment parameters as qbe, Ls, sx, sy, ... --------------------
+            if( !sed.Getinit() )  sed.Initialize( this );
 
-        case kDivCyc:
-          eqs_ppe2d.Execute( this );
-          break;
+            eqs_bl2d.Execute( this, EQS_BL2D::kQuadratic );
+            eqs_dz.QbDiff( this, EQS_BL2D::kQuadratic );
+
+            // detach memory for parameters ----------------------------------------------
+            sed.Detach();
+            break;
+
+
+          // -----------------------------------------------------------------------------
+          // divergence free flow field cycle
+
+          case kDivCyc:
+            eqs_ppe2d.Execute( this );
+            break;
 /*
-        case kDivCyc_LV:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          printTime( 1 );
+          case kDivCyc_LV:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            printTime( 1 );
 
-          eqs_ppe2d_lv.Execute( this, false );
-          break;
+            eqs_ppe2d_lv.Execute( this, false );
+            break;
 
-        case kDivCyc_LV_LM:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          printTime( 1 );
+          case kDivCyc_LV_LM:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            printTime( 1 );
 
-          eqs_ppe2d_lv.Execute( this, true );
-          break;
+            eqs_ppe2d_lv.Execute( this, true );
+            break;
 */
 
-        // -------------------------------------------------------------------------------
-        // other useful cycles
+          // -----------------------------------------------------------------------------
+          // other useful cycles
 
-        case kDryRewet:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kDryRewet:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          // dry and rewet algorithm
-          M2D->DoDryRewet( this );
-          break;
+            // dry and rewet algorithm
+            M2D->DoDryRewet( this );
+            break;
 
 
-        case kReOrderCyc:                                // Reorder Elements
-#         ifdef _MPI_
-          if( subdom.npr > 1 )
-            REPORT::rpt.Error( kParameterFault, "currently no cycle %d in MPI-Version", theCycle );
-#         endif
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kReOrderCyc:                                // Reorder Elements
+#           ifdef _MPI_
+            if( subdom.npr > 1 )
+              REPORT::rpt.Error( kParameterFault, "currently no cycle %d in MPI-Version", theCycle );
+#           endif
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          R2D->Connection( 0l );
+            R2D->Connection( 0l );
 
-          // reorder Elements
-          M2D->list = M2D->ReorderElem( nSection, section );
+            // reorder Elements
+            M2D->list = M2D->ReorderElem( nSection, section );
 
-          M2D->Initialize();
-          break;
+            M2D->Initialize();
+            break;
 
 
-        case kSurfaceCyc:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kSurfaceCyc:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          R2D->InitS( nSection, section );
+            R2D->InitS( nSection, section );
 
-          // compute friction coefficients
-          M2D->DoFriction( this );
+            // compute friction coefficients
+            M2D->DoFriction( this );
 
-          // initialize Reynolds stresses and eddy viscosity
-          R2D->Turbulence( this );
-          break;
+            // initialize Reynolds stresses and eddy viscosity
+            R2D->Turbulence( this );
+            break;
 
-        case kSurfaceToVol:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kSurfaceToVol:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          {
-            for( int e=0; e<R2D->Getne(); e++ )
             {
-              ELEM* el = R2D->Getelem(e);
-
-              el->P = 0.0;
-
-              if( !isFS(el->flag, ELEM::kDry) )
+              for( int e=0; e<R2D->Getne(); e++ )
               {
-                int ncn = el->Getncn();
+                ELEM* el = R2D->Getelem(e);
 
-                for( int i=0; i<ncn; i++ )
+                el->P = 0.0;
+
+                if( !isFS(el->flag, ELEM::kDry) )
                 {
-                  el->U += el->nd[i]->v.U;
-                  el->V += el->nd[i]->v.V;
-                  el->P += el->nd[i]->v.S;
+                  int ncn = el->Getncn();
+
+                  for( int i=0; i<ncn; i++ )
+                  {
+                    el->U += el->nd[i]->v.U;
+                    el->V += el->nd[i]->v.V;
+                    el->P += el->nd[i]->v.S;
+                  }
+
+                  el->P /= ncn;
+                  el->U /= ncn;
+                  el->V /= ncn;
                 }
-
-                el->P /= ncn;
-                el->U /= ncn;
-                el->V /= ncn;
               }
             }
-          }
-          break;
+            break;
 
-        case kOutputCyc:
-          // print information on actual iteration
-          PrintTheCycle( 1 );
-          REPORT::rpt.PrintTime( 1 );
+          case kOutputCyc:
+            // print information on actual iteration
+            PrintTheCycle( 1 );
+            REPORT::rpt.PrintTime( 1 );
 
-          // compute friction coefficients
-          M2D->DoFriction( this );
+            // compute friction coefficients
+            M2D->DoFriction( this );
 
-          // initialize Reynolds stresses and eddy viscosity
-          R2D->Turbulence( this );
+            // initialize Reynolds stresses and eddy viscosity
+            R2D->Turbulence( this );
 
-          // write output files
-          R2D->OutputData( this, iTM, timeint.actualTime.Get() );
+            // write output files
+            R2D->OutputData( this, iTM, timeint.actualTime.Get() );
 
-          M2D->Output( this, iTM );
-          M2D->DetachOutput( this );
+            M2D->Output( this, iTM );
+            M2D->DetachOutput( this );
 
-          if( *name.geometryFile )
-          {
-            R2D->OutputGeom( this, iTM );
-          }
-          break;
+            if( *name.geometryFile )
+            {
+              R2D->OutputGeom( this, iTM );
+            }
+            break;
 
 
-        default:
-          // compute friction coefficients
-          M2D->DoFriction( this );
+          default:
+            // compute friction coefficients
+            M2D->DoFriction( this );
 
-          // initialize Reynolds stresses and eddy viscosity
-          R2D->Turbulence( this );
-          break;
+            // initialize Reynolds stresses and eddy viscosity
+            R2D->Turbulence( this );
+            break;
+        }
       }
 
       MEMORY::memo.PrintInfo();
 
-      if( errLevel & kErr_interrupt )  break;
+      // repeat the sub step with reduced time increment ---------------------------------
+      if( timeint.adapt  &&  AdaptReject() )
+      {
+        if( sed.Getinit() )  sed.Detach();     // parameters of the rejected flow field
+
+        theCycle = NextCycle( &timeint.bconSet[bcSetNo], true );
+        continue;
+      }
+
+      if( errLevel & kErr_interrupt )
+      {
+        if( sed.Getinit() )  sed.Detach();
+        break;
+      }
 
       // determine the next iteration cycle ----------------------------------------------
       theCycle = NextCycle( &timeint.bconSet[bcSetNo], false );
@@ -755,6 +844,8 @@ void PROJECT::Compute()
       if( !theCycle )
       {
         // proceed to next time step -----------------------------------------------------
+        if( timeint.adapt )  AdaptNext();
+
         for( int i=0; i<R2D->Getnp(); i++ )
         {
           NODE* nd = R2D->Getnode(i);
@@ -789,6 +880,8 @@ void PROJECT::Compute()
 
           timeint.incTime = timeint.nextTime - timeint.actualTime;
 
+          if( timeint.adapt )  AdaptStart();
+
           theCycle = NextCycle( &timeint.bconSet[bcSetNo], true );
         }
         else
@@ -122,5 +122,7 @@ void GRID::Connection( long dry )
   }
 
 
+  dryRew.Disconnect();
+
   REPORT::rpt.Output( "\n (GRID::connection)      element connectivity set up\n", 4 );
 }
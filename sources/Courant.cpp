@@ -38,16 +38,37 @@
 #include "Elem.h"
 
 #include "Grid.h"
+#include "Project.h"
 
 
 double GRID::ReportCuPe( double dt, double vk )
+{
+  double maxCu[2], maxPe[2];
+
+  MaxCuPe( dt, vk, maxCu, maxPe );
+
+  REPORT::rpt.Message( 1, "\n\n%-25s%s\n",
+                          " (GRID::ReportCuPe)", "maximum of       CU           Pe");
+
+  REPORT::rpt.Message( 1, " %s %9.1le     %9.1le\n",
+                          "                        x-direction: ", maxCu[0], maxPe[0] );
+  REPORT::rpt.Message( 1, " %s %9.1le     %9.1le\n",
+                          "                        y-direction: ", maxCu[1], maxPe[1] );
+
+  if( maxCu[0] > maxCu[1] )  return maxCu[0];
+  else                       return maxCu[1];
+}
+
+
+// ---------------------------------------------------------------------------------------
+// maximum Courant- and Peclet-Number in x- and y-direction: cu[0,1] and pe[0,1]
+
+void GRID::MaxCuPe( double dt, double vk, double* cu, double* pe )
 {
   double maxCu_x, maxCu_y;
   double maxPe_x, maxPe_y;
 
 
-  // report Courant- and Peclet-Number: Cu and Pe ------------------------------------------
-
   int*    counter = (int*)    MEMORY::memo.Array_nd( np );
   double* xnd     = (double*) MEMORY::memo.Array_nd( np );
   double* ynd     = (double*) MEMORY::memo.Array_nd( np );
@@ -131,20 +152,109 @@ double GRID::ReportCuPe( double dt, double vk )
   }
 
 
-  REPORT::rpt.Message( 1, "\n\n%-25s%s\n",
-                          " (GRID::ReportCuPe)", "maximum of       CU           Pe");
-
-  REPORT::rpt.Message( 1, " %s %9.1le     %9.1le\n",
-                          "                        x-direction: ", maxCu_x, maxPe_x );
-  REPORT::rpt.Message( 1, " %s %9.1le     %9.1le\n",
-                          "                        y-direction: ", maxCu_y, maxPe_y );
-
-
   MEMORY::memo.Detach( counter );
   MEMORY::memo.Detach( xnd );
   MEMORY::memo.Detach( ynd );
 
+  cu[0] = maxCu_x;
+  cu[1] = maxCu_y;
+
+  pe[0] = maxPe_x;
+  pe[1] = maxPe_y;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// factors for local pseudo time steps in time relaxed stationary computations
+//
+// The characteristic time of an element is the time a wave (U + sqrt(gH)) needs to pass
+// the element extent in x- and y-direction. The element with the shortest time gets
+// the global relaxation time, larger elements a time step longer by the ratio of their
+// characteristic times, limited to project->relaxLocal. The factors fac[] multiply the
+// inverse of the relaxation time (1: global time step).
+// For the turbulence equations (turb = true) the characteristic time is limited by the
+// time scale of turbulence K/D, since the source terms are stiff there.
+
+void GRID::LocalTime( PROJECT* project, double* fac, int turb )
+{
+  double g      = project->g;
+  double maxFac = 1.0;
+
+  if( project->relaxLocal > 1.0 )  maxFac = project->relaxLocal;
+
+  double tmin = 0.0;
+
+  for( int e=0; e<ne; e++ )
+  {
+    ELEM* el = &elem[e];
+
+    fac[e] = 0.0;
+
+    if( !isFS(el->flag, ELEM::kRegion)  ||  isFS(el->flag, ELEM::kDry) )  continue;
+
+    int    ncn = el->Getncn();
+    double xe  = 0.0;
+    double ye  = 0.0;
+    double U   = 0.0;
+    double V   = 0.0;
+    double H   = 0.0;
+    double K   = 0.0;
+    double D   = 0.0;
+
+    for( int i=0; i<ncn; i++ )
+    {
+      NODE* nd = el->nd[i];
+
+      double x = fabs( nd->x - el->nd[0]->x );
+      double y = fabs( nd->y - el->nd[0]->y );
+
+      if( x > xe ) xe = x;
+      if( y > ye ) ye = y;
+
+      U += nd->v.U;
+      V += nd->v.V;
+      H += nd->v.S - nd->z;
+      K += nd->v.K;
+      D += nd->v.D;
+    }
+
+    U /= ncn;
+    V /= ncn;
+    H /= ncn;
+
+    double c = 0.0;
+    if( H > 0.0 )  c = sqrt( g * H );
+
+    double cx = fabs(U) + c;
+    double cy = fabs(V) + c;
 
-  if( maxCu_x > maxCu_y )  return maxCu_x;
-  else                     return maxCu_y;
+    if( cx <= 0.0  ||  cy <= 0.0 )  continue;
+
+    double tx = xe / cx;
+    double ty = ye / cy;
+
+    fac[e] = (tx < ty)? tx : ty;
+
+    if( turb  &&  D > 0.0  &&  K / D < fac[e] )  fac[e] = K / D;
+
+    if( fac[e] > 0.0  &&  (tmin <= 0.0  ||  fac[e] < tmin) )  tmin = fac[e];
+  }
+
+  if( tmin <= 0.0 )  tmin = 1.0e99;
+  tmin = project->subdom.Mpi_min( tmin );
+
+  double minFac = 1.0 / maxFac;
+
+  for( int e=0; e<ne; e++ )
+  {
+    if( fac[e] > 0.0 )
+    {
+      fac[e] = tmin / fac[e];
+      if( fac[e] < minFac )  fac[e] = minFac;
+    }
+    else
+    {
+      fac[e] = 1.0;
+    }
+  }
 }
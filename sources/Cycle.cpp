@@ -37,10 +37,12 @@
 #include "Project.h"
 
 
+// index of the next cycle in the cycle-array of the actual boundary condition set
+static int actualCycle = 0;
+
+
 int PROJECT::NextCycle( BCONSET* bconSet, int reset )
 {
-  static int actualCycle = 0;
-
   if( reset ) actualCycle = 0;
 
 
@@ -53,6 +55,21 @@ int PROJECT::NextCycle( BCONSET* bconSet, int reset )
 
     if( flowFlag )  next = abs(next);
 
+    // skip flow cycles for small changes of the bed (SED::skipFlow) ---------------------
+    if( next > 0  &&  SkipCycle(next) )
+    {
+      REPORT::rpt.Message( 1, "\n%-25s%s %d\n",
+                              " (PROJECT::NextCycle)", "skipped flow cycle", next );
+
+      if( actualCycle < kMaxCycles-1 )
+      {
+        actualCycle++;
+        continue;
+      }
+
+      next = 0;
+    }
+
     if( next >= 0 )
     {
       break;
@@ -100,6 +117,27 @@ int PROJECT::NextCycle( BCONSET* bconSet, int reset )
 }
 
 
+// ---------------------------------------------------------------------------------------
+// return the cycle that follows the actual one without changing the state of NextCycle()
+// ---------------------------------------------------------------------------------------
+
+int PROJECT::PeekCycle( BCONSET* bconSet )
+{
+  for( int i=actualCycle; i<kMaxCycles; i++ )
+  {
+    int next = bconSet->cycle[i];
+
+    if( flowFlag )  next = abs(next);
+
+    if( next > 0  &&  SkipCycle(next) )  continue;
+
+    if( next >= 0 )  return next;
+  }
+
+  return 0;
+}
+
+
 void PROJECT::PrintTheCycle( int iter )
 {
   char ltxt[120];
@@ -230,3 +268,119 @@ void PROJECT::PrintTheCycle( int iter )
 
   REPORT::rpt.Message( 1, " %-26s  %50s\n", ltxt, rtxt );
 }
+
+
+// ---------------------------------------------------------------------------------------
+// data classes read and written by a cycle (PROJECT::kData...); the table is used to
+// decide, which computations may run concurrently without changing the results.
+// Unknown cycles read and write everything.
+// ---------------------------------------------------------------------------------------
+
+void PROJECT::CycleData( int cycle, int* read, int* write )
+{
+  switch( cycle )
+  {
+    case kUVSCyc:
+    case kUVS_TMCyc:
+    case kUVS_LVCyc:
+      *read  = kDataAll;
+      *write = kDataUVS | kDataVt | kDataWet;
+      break;
+
+    case kDispCurv2D:
+      *read  = kDataUVS | kDataVt | kDataZ | kDataWet;
+      *write = kDataDisp;
+      break;
+
+    case kKDInitCyc:
+    case kKLCyc:
+    case kKDCyc:
+    case kKD_LCyc:
+    case kKCyc:
+    case kDCyc:
+      *read  = kDataUVS | kDataKD | kDataVt | kDataZ | kDataWet;
+      *write = kDataKD | kDataVt;
+      break;
+
+    case kQbCyc:
+    case kSLCyc:
+    case kBLCyc:
+    case kBSLCyc:
+    case kDiffBLCyc:
+      *read  = kDataAll;
+      *write = kDataQb | kDataC | kDataZ | kDataSed;
+      break;
+
+    case kDivCyc:
+      *read  = kDataUVS | kDataZ | kDataWet;
+      *write = kDataUVS;
+      break;
+
+    case kOutputCyc:
+      *read  = kDataAll;
+      *write = kDataVt | kDataSed | kDataOut;
+      break;
+
+    default:                      // kKD_QCyc inserts nodes, kDryRewet, kReOrderCyc, ...
+      *read  = kDataAll;
+      *write = kDataAll;
+      break;
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// return true, if the sediment parameters of cycle "next" (SED::Initialize) may be
+// computed concurrently with "cycle": no data of the one task is written by the other
+// ---------------------------------------------------------------------------------------
+
+int PROJECT::Overlap( int cycle, int next )
+{
+  switch( next )
+  {
+    case kQbCyc:
+    case kSLCyc:
+    case kBLCyc:
+    case kBSLCyc:
+    case kDiffBLCyc:
+      break;
+
+    default:                      // no sediment cycle
+      return false;
+  }
+
+  // SED::Initialize: transport direction, bed slope and transport capacity --------------
+  int sedRead  = kDataUVS | kDataDisp | kDataZ | kDataWet;
+  int sedWrite = kDataSed;
+
+  int read, write;
+
+  CycleData( cycle, &read, &write );
+
+  if( write & sedRead )   return false;        // read after write
+  if( read  & sedWrite )  return false;        // write after read
+  if( write & sedWrite )  return false;        // write after write
+
+  return true;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// return true, if the cycle is skipped in the actual time step: flow and turbulence
+// cycles are not repeated while the bed changes are small (SED::skipFlow)
+// ---------------------------------------------------------------------------------------
+
+int PROJECT::SkipCycle( int cycle )
+{
+  if( !skipFlow )  return false;
+
+  int read, write;
+
+  CycleData( cycle, &read, &write );
+
+  if( write == kDataAll )  return false;
+
+  if( write & (kDataUVS | kDataKD | kDataDisp) )  return true;
+
+  return false;
+}
@@ -48,6 +48,7 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1992     sc     first implementation / first concept
+//  19.10.2026     ag     kBatchLanes: number of elements in a batch of coefficients
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -67,6 +68,13 @@
 //#define kRangeCheck
 //#define kIteratCount
 
+//#define _HUGEPAGES             // back large scratch arrays by huge pages (MEMORY)
+//#define _COWI_NEWTON           // Newton iteration for Colebrook-White's law (TYPE::friction)
+
+#ifndef kBatchLanes              // elements in a batch of coefficients (EQS::kBatch): 4 or 8,
+#define kBatchLanes  4           // e.g. make COPT="-O2 -DkBatchLanes=8"
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
@@ -47,30 +47,60 @@
 //#define kDebug_2
 
 
-void MODEL::DoDryRewet( PROJECT* project, int* dried, int* wetted )
+void MODEL::DoDryRewet( PROJECT* project, int* dried, int* wetted, int front )
 {
   DRYREW *dryRew = &region->dryRew;
 
-  region->Connection( 0L );
-
   int del = 0;
   int wel = 0;
 
-  if( dryRew->method == 1 )
+  if( front )
   {
-    // mark nodes and elements to be rewetted ------------------------------------------------------
-    wel = region->Rewet( dryRew->rewetLimit, dryRew->rewetPasses, project );
+    // check only the wet/dry line of the last check (method 2, one process) ----------------
+    // the front keeps its own connection to dry elements (GRID::SetFront); the connectivity
+    // NODE::el of wet elements is left as it is and rebuilt only, if nodes or elements have
+    // changed their state
 
-    // mark dry nodes and elements -----------------------------------------------------------------
-    del = region->Dry( dryRew->dryLimit, dryRew->countDown );
-  }
-  else if( dryRew->method == 2 )
-  {
-    region->DryRewet( dryRew->dryLimit, dryRew->rewetLimit, dryRew->countDown, &del, &wel );
+    int single = true;
+
+#   ifdef _MPI_
+    if( project->subdom.npr > 1 )  single = false;
+#   endif
+
+    if( dryRew->method != 2  ||  !region->dryFront.valid  ||  !single )
+    {
+      if( dried )  *dried  = 0;
+      if( wetted ) *wetted = 0;
+
+      return;
+    }
+
+    DRYFRONT* fr = &region->dryFront;
+
+    region->DryRewet( dryRew->dryLimit, dryRew->rewetLimit, dryRew->countDown, &del, &wel,
+                      fr->nNode, fr->node, fr->nElem, fr->elem );
   }
-  else if( dryRew->method == 3 )
+
+  else
   {
-    region->RewetDry( dryRew->dryLimit, dryRew->rewetLimit, dryRew->countDown, &del, &wel );
+    region->Connection( 0L );
+
+    if( dryRew->method == 1 )
+    {
+      // mark nodes and elements to be rewetted ----------------------------------------------------
+      wel = region->Rewet( dryRew->rewetLimit, dryRew->rewetPasses, project );
+
+      // mark dry nodes and elements ---------------------------------------------------------------
+      del = region->Dry( dryRew->dryLimit, dryRew->countDown );
+    }
+    else if( dryRew->method == 2 )
+    {
+      region->DryRewet( dryRew->dryLimit, dryRew->rewetLimit, dryRew->countDown, &del, &wel );
+    }
+    else if( dryRew->method == 3 )
+    {
+      region->RewetDry( dryRew->dryLimit, dryRew->rewetLimit, dryRew->countDown, &del, &wel );
+    }
   }
 /*
   // future work ...
@@ -90,11 +120,14 @@ void MODEL::DoDryRewet( PROJECT* project, int* dried, int* wetted )
 
   char text [200];
 
-  sprintf( text, "\n (MODEL::DoDryRewet)     %d elements have got dry\n", del );
-  REPORT::rpt.Output( text, 3 );
+  if( !front  ||  del + wel > 0 )
+  {
+    sprintf( text, "\n (MODEL::DoDryRewet)     %d elements have got dry\n", del );
+    REPORT::rpt.Output( text, 3 );
 
-  sprintf( text, "\n (MODEL::DoDryRewet)     %d elements have got wet\n", wel );
-  REPORT::rpt.Output( text, 3 );
+    sprintf( text, "\n (MODEL::DoDryRewet)     %d elements have got wet\n", wel );
+    REPORT::rpt.Output( text, 3 );
+  }
 
   int dryRewFlag = del + wel;
 
@@ -224,7 +257,7 @@ void MODEL::DoDryRewet( PROJECT* project, int* dried, int* wetted )
 //  ================================================================================================
   }
 
-  else
+  else if( !front )
   {
     // set up structure for connection of nodes to elements ----------------------------------------
     // dry elements are not taken into consideration
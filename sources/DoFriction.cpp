@@ -51,6 +51,7 @@
 #include "Elem.h"
 #include "Project.h"
 
+#include "Grid.h"
 #include "Model.h"
 
 
@@ -58,7 +59,7 @@ void MODEL::DoFriction( PROJECT* project )
 {
   int    i, cnt;
 
-  double cf, h, U, V, Vres;
+  double h, U, V;
   double Ust, dwPlus, dwMax, dwMin, dwAve;
   char   text[500];
 
@@ -73,16 +74,156 @@ void MODEL::DoFriction( PROJECT* project )
 
   // allocations and initializations -----------------------------------------------------
 
-  int* counter  = (int*) MEMORY::memo.Array_nd( np );
+  int*    counter = (int*)    MEMORY::memo.Array_nd( np );
+  double* sumcf   = (double*) MEMORY::memo.Array_nd( np );
+
+
+  // The friction coefficient at a node depends on the material type of the element
+  // only, so that it is computed once for each pair (node,type): the type of the last
+  // evaluation at a node is reminded in ntype[] together with the coefficient ncf[].
+
+  int*    ntype = (int*)    MEMORY::memo.Array_nd( np );
+  double* ncf   = (double*) MEMORY::memo.Array_nd( np );
 
   for( i=0; i<np; i++ )
   {
-    rg->Getnode(i)->cf = 0.0;
+    sumcf[i]   = 0.0;
     counter[i] = 0;
+    ntype[i]   = -1;
+  }
+
+
+  // Friction is recomputed only at nodes whose flow state has changed by more than the
+  // limits project->changeUV/changeS since their last evaluation (GRID::fricChange);
+  // the other nodes keep their friction coefficient.
+
+  char* changed = (char*) MEMORY::memo.Array_nd( np );
+
+  rg->fricChange.Mark( rg, project->changeUV, project->changeS, changed );
+
+# ifdef _MPI_
+  // interface nodes are always recomputed, since cf is assembled across subdomains
+  if( project->subdom.npr > 1 )
+  {
+    SUBDOM* subdom = &project->subdom;
+    INFACE* inface = subdom->inface;
+
+    for( int s=0; s<subdom->npr; s++ )
+    {
+      for( int n=0; n<inface[s].np; n++ )  changed[inface[s].node[n]->Getno()] = true;
+    }
+  }
+# endif
+
+
+  // first loop on all elements: list the pairs (node,type) to be computed --------------
+
+  int nslot = 0;
+
+  for( int e=0; e<ne; e++ )  nslot += rg->Getelem(e)->Getnnd();
+
+  int*    pno   = (int*)    MEMORY::memo.Array( nslot );
+  int*    ptype = (int*)    MEMORY::memo.Array( nslot );
+  double* pcf   = (double*) MEMORY::memo.Array( nslot );
+
+  int npair = 0;
+
+  for( int e=0; e<ne; e++ )
+  {
+    ELEM* el   = rg->Getelem(e);
+
+    int   nnd  = el->Getnnd();
+    TYPE* type = TYPE::Getid( el->type );
+
+    if( type->rtype > 0 )
+    {
+      for( i=0; i<nnd; i++ )
+      {
+        int no = el->nd[i]->Getno();
+
+        if( !changed[no]  ||  ntype[no] == el->type )  continue;
+
+        ntype[no]    = el->type;
+        pno[npair]   = no;
+        ptype[npair] = el->type;
+        npair++;
+      }
+    }
+  }
+
+
+  // compute friction coefficients of the pairs in batches of the same type -------------
+  // the solution of Colebrook-White's law at the node is used as start value
+
+  for( int p=0; p<npair; )
+  {
+    TYPE* type = TYPE::Getid( ptype[p] );
+
+    double Us[TYPE::kBatch];
+    double H[TYPE::kBatch];
+    double cw[TYPE::kBatch];
+
+    int n = 0;
+
+    while( p+n < npair  &&  ptype[p+n] == ptype[p]  &&  n < TYPE::kBatch )
+    {
+      NODE* nd = rg->Getnode( pno[p+n] );
+
+      h = nd->v.S - nd->z;
+
+      if( h < project->hmin )  h = project->hmin;
+
+      U = nd->v.U;
+      V = nd->v.V;
+
+      Us[n] = sqrt( U*U + V*V );
+      H[n]  = h;
+      cw[n] = nd->cw;
+      n++;
+    }
+
+    // ### test - 10.01.2008 #######################################################
+    // ### compute laminar roughness coefficient for marsh nodes
+    //if( isFS(el->nd[i]->flag, NODE::kMarsh)  &&  Vres > 1.0e-6 )
+    //{
+    //  double Re = Vres * 4.0 * h / project->vk;
+    //  cf = 8.0 / Re;
+    //}
+    //else
+    //{
+    //  cf = type->bottom( Vres, h, project->kappa,
+    //                     project->vk, project->dw, project->g );
+    //}
+    // ### end of test - 10.01.2008 ################################################
+
+    switch( type->kslaw )
+    {
+      case 0:
+      case 1:
+        type->bottom( n, Us, H, project->kappa, project->vk, project->g,
+                      project->rho, project->sed.rhob, type->d50, type->d90,
+                      cw, &pcf[p] );
+        break;
+
+      case 2:
+        type->bottom( n, Us, H, project->kappa, project->vk, project->g,
+                      project->rho, project->sed.rhob, project->sed.d50, project->sed.d90,
+                      cw, &pcf[p] );
+        break;
+    }
+
+    for( int k=0; k<n; k++ )  rg->Getnode(pno[p+k])->cw = cw[k];
+
+    p += n;
   }
 
 
-  // loop on all elements: compute friction coefficient at nodes -------------------------
+  // second loop on all elements: sum up friction coefficients at nodes -----------------
+  // the pairs are visited in the same order as in the first loop
+
+  for( i=0; i<np; i++ )  ntype[i] = -1;
+
+  int pair = 0;
 
   for( int e=0; e<ne; e++ )
   {
@@ -95,53 +236,26 @@ void MODEL::DoFriction( PROJECT* project )
     {
       for( i=0; i<nnd; i++ )
       {
-        h = el->nd[i]->v.S - el->nd[i]->z;
-
-        if( h < project->hmin )  h = project->hmin;
-
-        U = el->nd[i]->v.U;
-        V = el->nd[i]->v.V;
-
-        Vres = sqrt( U*U + V*V );
-
-        // ### test - 10.01.2008 #########################################################
-        // ### compute laminar roughness coefficient for marsh nodes
-        //if( isFS(el->nd[i]->flag, NODE::kMarsh)  &&  Vres > 1.0e-6 )
-        //{
-        //  double Re = Vres * 4.0 * h / project->vk;
-        //  cf = 8.0 / Re;
-        //}
-        //else
-        //{
-        //  cf = type->bottom( Vres, h, project->kappa,
-        //                     project->vk, project->dw, project->g );
-        //}
-        // ### end of test - 10.01.2008 ##################################################
-
-        switch( type->kslaw )
+        int no = el->nd[i]->Getno();
+
+        if( !changed[no] )  continue;
+
+        if( ntype[no] != el->type )
         {
-          case 0:
-            cf = type->bottom( Vres, h, project->kappa, project->vk, project->g,
-                               project->rho, project->sed.rhob, type->d50, type->d90 );
-            break;
-
-          case 1:
-            cf = type->bottom( Vres, h, project->kappa, project->vk, project->g,
-                               project->rho, project->sed.rhob, type->d50, type->d90 );
-            break;
-
-          case 2:
-            cf = type->bottom( Vres, h, project->kappa, project->vk, project->g,
-                               project->rho, project->sed.rhob, project->sed.d50, project->sed.d90 );
-            break;
+          ntype[no] = el->type;
+          ncf[no]   = pcf[pair++];
         }
 
-        el->nd[i]->cf += el->areaFact * cf;
-        counter[ el->nd[i]->Getno() ]++;
+        sumcf[no] += el->areaFact * ncf[no];
+        counter[no]++;
       }
     }
   }
 
+  MEMORY::memo.Detach( pno );
+  MEMORY::memo.Detach( ptype );
+  MEMORY::memo.Detach( pcf );
+
 
   ////////////////////////////////////////////////////////////////////////////////////////
   // MPI: assemble friction coefficient cf across interfaces
@@ -168,7 +282,7 @@ void MODEL::DoFriction( PROJECT* project )
           NODE* nd = inface[s].node[n];
 
           inface[s].sia2[n] = counter[nd->Getno()];
-          inface[s].send[n] = nd->cf;
+          inface[s].send[n] = sumcf[nd->Getno()];
         }
 
         MPI_Sendrecv( inface[s].sia2, npinf, MPI_INT, s, 1,
@@ -184,7 +298,7 @@ void MODEL::DoFriction( PROJECT* project )
           NODE* nd = inface[s].node[n];
 
           counter[nd->Getno()] += inface[s].ria2[n];
-          nd->cf               += inface[s].recv[n];
+          sumcf[nd->Getno()]   += inface[s].recv[n];
         }
       }
     }
@@ -194,13 +308,16 @@ void MODEL::DoFriction( PROJECT* project )
 # endif
   ////////////////////////////////////////////////////////////////////////////////////////
 
-  // divide cf-array by counter ----------------------------------------------------------
+  // divide cf-array by counter and copy to changed nodes -------------------------------
 
   for( int i=0; i<np; i++ )
   {
-    NODE* nd = rg->Getnode(i);
+    if( changed[i] )
+    {
+      if( counter[i] ) sumcf[i] /= counter[i];
 
-    if( counter[i] ) nd->cf /= counter[i];
+      rg->Getnode(i)->cf = sumcf[i];
+    }
 
     counter[i] = 0;
   }
@@ -213,4 +330,8 @@ void MODEL::DoFriction( PROJECT* project )
 
 
   MEMORY::memo.Detach( counter );
+  MEMORY::memo.Detach( sumcf );
+  MEMORY::memo.Detach( ntype );
+  MEMORY::memo.Detach( ncf );
+  MEMORY::memo.Detach( changed );
 }
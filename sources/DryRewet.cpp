@@ -324,8 +324,14 @@ int GRID::Rewet( double   rewetLimit,
               el->nd[j]->v.dSdt = 0.0;
 
 
-              K = el->nd[j]->v.K = dryRew.interpolate(el->nd[j], kVarK, 1);
-              D = el->nd[j]->v.D = dryRew.interpolate(el->nd[j], kVarD, 1);
+              int    varKD[2] = { kVarK, kVarD };
+              double valKD[2];
+
+              dryRew.Connect( this );
+              dryRew.interpolate( el->nd[j], 1, 2, varKD, valKD );
+
+              K = el->nd[j]->v.K = valKD[0];
+              D = el->nd[j]->v.D = valKD[1];
 
               if( isFS(project->actualTurb, BCONSET::kVtConstant) )
               {
@@ -691,20 +697,30 @@ void GRID::ReportDry( PROJECT* project,
 //////////////////////////////////////////////////////////////////////////////////////////
 // mark dry nodes and elements (method 2)
 // this method will keep dried nodes dry until countDown counts to zero
+// the check may be restricted to the nodes ndList[0..nnode-1] and the elements
+// elList[0..nelem-1]; ndList has to contain all nodes of these elements (see SetFront)
 //////////////////////////////////////////////////////////////////////////////////////////
 
 void GRID::DryRewet( double  dryLimit,
                      double  rewetLimit,
                      int     countDown,
                      int*    dried,
-                     int*    wetted )
+                     int*    wetted,
+                     int     nnode,
+                     int*    ndList,
+                     int     nelem,
+                     int*    elList )
 {
+  if( !ndList )  nnode = Getnp();
+  if( !elList )  nelem = Getne();
+
+
   // -------------------------------------------------------------------------------------
   // check for dry nodes
 
-  for( int n=0; n<Getnp(); n++ )
+  for( int n=0; n<nnode; n++ )
   {
-    NODE* nd = Getnode(n);
+    NODE* nd = Getnode( ndList? ndList[n] : n );
 
     // mark recently dry nodes
     if( isFS(nd->flag, NODE::kDry) )  nd->mark = true;
@@ -733,9 +749,9 @@ void GRID::DryRewet( double  dryLimit,
   // -------------------------------------------------------------------------------------
   // loop on all elements: check for dry elements
 
-  for( int e=0; e<Getne(); e++ )
+  for( int e=0; e<nelem; e++ )
   {
-    ELEM* el = Getelem(e);
+    ELEM* el = Getelem( elList? elList[e] : e );
 
     // mark elements that have been dry --------------------------------------------------
     if( isFS(el->flag, ELEM::kDry) )  el->mark = true;
@@ -778,17 +794,17 @@ void GRID::DryRewet( double  dryLimit,
   // -------------------------------------------------------------------------------------
   // loop on all elements: all nodes at wet elements are wet
 
-  for( int n=0; n<Getnp(); n++ )
+  for( int n=0; n<nnode; n++ )
   {
-    SF( Getnode(n)->flag, NODE::kDry );
+    SF( Getnode( ndList? ndList[n] : n )->flag, NODE::kDry );
   }
 
 
   // initialize water surface in marsh elements
 
-  for( int e=0; e<Getne(); e++ )
+  for( int e=0; e<nelem; e++ )
   {
-    ELEM* el = Getelem(e);
+    ELEM* el = Getelem( elList? elList[e] : e );
 
     if( !isFS(el->flag, ELEM::kDry) )
     {
@@ -878,9 +894,9 @@ void GRID::DryRewet( double  dryLimit,
   // -------------------------------------------------------------------------------------
   // interpolate midside nodes
 
-  for( int e=0; e<Getne(); e++ )
+  for( int e=0; e<nelem; e++ )
   {
-    ELEM* el = Getelem(e);
+    ELEM* el = Getelem( elList? elList[e] : e );
 
     int ncn = el->Getncn();
     int nnd = el->Getnnd();
@@ -917,9 +933,9 @@ void GRID::DryRewet( double  dryLimit,
   // -------------------------------------------------------------------------------------
   // initialize dry nodes
 
-  for( int n=0; n<Getnp(); n++ )
+  for( int n=0; n<nnode; n++ )
   {
-    NODE* nd = Getnode(n);
+    NODE* nd = Getnode( ndList? ndList[n] : n );
 
     if( isFS(nd->flag, NODE::kDry) )
     {
@@ -946,9 +962,9 @@ void GRID::DryRewet( double  dryLimit,
 
   int cnt = 0;
 
-  for( int e=0; e<Getne(); e++ )
+  for( int e=0; e<nelem; e++ )
   {
-    ELEM* el = Getelem(e);
+    ELEM* el = Getelem( elList? elList[e] : e );
 
     if( isFS(el->flag, ELEM::kDry)  &&  !el->mark )
     {
@@ -969,9 +985,9 @@ void GRID::DryRewet( double  dryLimit,
 
   cnt = 0;
 
-  for( int e=0; e<Getne(); e++ )
+  for( int e=0; e<nelem; e++ )
   {
-    ELEM* el = Getelem(e);
+    ELEM* el = Getelem( elList? elList[e] : e );
 
     if( !isFS(el->flag, ELEM::kDry)  &&  el->mark )
     {
@@ -988,6 +1004,12 @@ void GRID::DryRewet( double  dryLimit,
   *wetted += cnt;
 
 
+  // -------------------------------------------------------------------------------------
+  // nodes and elements near the wet/dry line for the next check
+
+  SetFront( nelem, elList );
+
+
   // -------------------------------------------------------------------------------------
   // following the complete list of dry / marsh elements
 
@@ -1516,3 +1538,200 @@ void GRID::RewetDry( double  dryLimit,
 
 # endif
 }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// front tracking dry/rewet (method 2)
+//////////////////////////////////////////////////////////////////////////////////////////
+
+DRYFRONT::~DRYFRONT()
+{
+  Free();
+}
+
+
+void DRYFRONT::Free()
+{
+  delete[] node;
+  delete[] elem;
+  delete[] conStart;
+  delete[] conElem;
+  delete[] ndFlag;
+  delete[] elFlag;
+
+  np       = 0;
+  ne       = 0;
+  node     = NULL;
+  elem     = NULL;
+  conStart = NULL;
+  conElem  = NULL;
+  ndFlag   = NULL;
+  elFlag   = NULL;
+
+  valid   = false;
+  nNode   = 0;
+  nElem   = 0;
+}
+
+
+static int CompareInt( const void* p1, const void* p2 )
+{
+  int i1 = *(const int*) p1;
+  int i2 = *(const int*) p2;
+
+  if( i1 < i2 )  return -1;
+  if( i1 > i2 )  return  1;
+  return 0;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Set up the front from the flags of the elements list[0..nel-1] (all elements, if list
+// is NULL): nodes of marsh elements, nodes with a running count down and all nodes of
+// elements connected to them. Only these nodes may change their state by the next check.
+// The front is given to DryRewet() as the list of elements connected to these nodes and
+// the list of all nodes of these elements. Dry elements are included; their connection to
+// nodes is set up here once for the element array of the grid and kept until the next
+// DRYFRONT::Free(), so that NODE::el may hold wet elements only (Connection(ELEM::kDry)).
+
+void GRID::SetFront( int nel, int* list )
+{
+  DRYFRONT* fr = &dryFront;
+
+  if( fr->np != np  ||  fr->ne != ne )
+  {
+    fr->Free();
+
+    fr->node   = new int [np];
+    fr->elem   = new int [ne];
+    fr->ndFlag = new char [np];
+    fr->elFlag = new char [ne];
+
+    if( !fr->node || !fr->elem || !fr->ndFlag || !fr->elFlag )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - GRID::SetFront(1)" );
+
+    for( int n=0; n<np; n++ )  fr->ndFlag[n] = false;
+    for( int e=0; e<ne; e++ )  fr->elFlag[e] = false;
+
+    fr->np = np;
+    fr->ne = ne;
+
+
+    // connection of region elements to nodes in ascending order of elements ------------
+    fr->conStart = new int [np+1];
+
+    if( !fr->conStart )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - GRID::SetFront(2)" );
+
+    for( int n=0; n<=np; n++ )  fr->conStart[n] = 0;
+
+    for( int e=0; e<ne; e++ )
+    {
+      ELEM* el = &elem[e];
+
+      if( !isFS(el->flag, ELEM::kRegion) )  continue;
+
+      for( int i=0; i<el->Getnnd(); i++ )  fr->conStart[el->nd[i]->Getno() + 1]++;
+    }
+
+    for( int n=0; n<np; n++ )  fr->conStart[n+1] += fr->conStart[n];
+
+    fr->conElem = new int [fr->conStart[np] + 1];
+
+    if( !fr->conElem )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - GRID::SetFront(3)" );
+
+    int* pos = fr->node;                             // scratch: next free position
+
+    for( int n=0; n<np; n++ )  pos[n] = fr->conStart[n];
+
+    for( int e=0; e<ne; e++ )
+    {
+      ELEM* el = &elem[e];
+
+      if( !isFS(el->flag, ELEM::kRegion) )  continue;
+
+      for( int i=0; i<el->Getnnd(); i++ )  fr->conElem[pos[el->nd[i]->Getno()]++] = e;
+    }
+  }
+
+
+  // nodes of marsh elements and nodes with running count down ---------------------------
+  // the list may be fr->elem, which is not read after this loop
+
+  fr->nNode = 0;
+
+  if( !list )  nel = ne;
+
+  for( int k=0; k<nel; k++ )
+  {
+    ELEM* el = &elem[list? list[k] : k];
+
+    int nnd   = el->Getnnd();
+    int marsh = isFS(el->flag, ELEM::kMarsh);
+
+    for( int i=0; i<nnd; i++ )
+    {
+      NODE* nd = el->nd[i];
+      int   n  = nd->Getno();
+
+      if(     !fr->ndFlag[n]
+          &&  (marsh  ||  (nd->countDown > 0  &&  !isFS(nd->flag, NODE::kDry))) )
+      {
+        fr->ndFlag[n] = true;
+        fr->node[fr->nNode++] = n;
+      }
+    }
+  }
+
+
+  // add nodes of connected elements; then elements connected to all these nodes ---------
+  // and their nodes
+
+  fr->nElem = 0;
+
+  for( int pass=0; pass<2; pass++ )
+  {
+    int nLine = fr->nNode;
+
+    for( int k=0; k<nLine; k++ )
+    {
+      int n = fr->node[k];
+
+      for( int j=fr->conStart[n]; j<fr->conStart[n+1]; j++ )
+      {
+        ELEM* el = &elem[fr->conElem[j]];
+
+        if( pass == 1 )
+        {
+          int e = el->Getno();
+
+          if( fr->elFlag[e] )  continue;
+
+          fr->elFlag[e] = true;
+          fr->elem[fr->nElem++] = e;
+        }
+
+        int nnd = el->Getnnd();
+
+        for( int i=0; i<nnd; i++ )
+        {
+          int m = el->nd[i]->Getno();
+
+          if( !fr->ndFlag[m] )
+          {
+            fr->ndFlag[m] = true;
+            fr->node[fr->nNode++] = m;
+          }
+        }
+      }
+    }
+  }
+
+  for( int k=0; k<fr->nNode; k++ )  fr->ndFlag[fr->node[k]] = false;
+  for( int k=0; k<fr->nElem; k++ )  fr->elFlag[fr->elem[k]] = false;
+
+  qsort( fr->elem, fr->nElem, sizeof(int), CompareInt );
+
+  fr->valid = true;
+}
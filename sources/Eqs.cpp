@@ -72,6 +72,15 @@ EQS::EQS( int dfcn, int dfmn, int dfel )
   if( !force  || !estifm )
     REPORT::rpt.Error( kMemoryFault, "can not allocate memory (EQS::EQS - 1)" );
 
+  for( int b=0; b<kBatch; b++ )
+  {
+    estifmBatch[b] = MEMORY::memo.Dmatrix( maxEleq, maxEleq );
+    forceBatch[b]  = new double [maxEleq];
+
+    if( !forceBatch[b]  ||  !estifmBatch[b] )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory (EQS::EQS - 2)" );
+  }
+
 
   // further initializations -------------------------------------------------------------
 
@@ -81,6 +90,26 @@ EQS::EQS( int dfcn, int dfmn, int dfel )
 
   iterCountCG = 0;
 
+  localFac = NULL;
+
+  eta     = 0.0;
+  etaNorm = 0.0;
+
+  auxiliary = false;
+
+  jfnk      = false;
+  jfnkForce = NULL;
+  jfnkScale = 1.0;
+
+  crsmScale = 1.0;
+
+  stable     = false;
+  stableNeq  = 0;
+  stableNode = NULL;
+  stableElem = NULL;
+  nmask      = 0;
+  mask       = NULL;
+
   nodeEqno = NULL;
   elemEqno = NULL;
 
@@ -104,9 +133,30 @@ EQS::~EQS()
     delete[] elemEqno;
   }
 
+  if( stableNode )
+  {
+    delete[] stableNode[0];
+    delete[] stableNode;
+  }
+
+  if( stableElem )
+  {
+    delete[] stableElem[0];
+    delete[] stableElem;
+  }
+
+  delete[] mask;
+
   delete[] force;
 
   MEMORY::memo.Delete( estifm );
+
+  for( int b=0; b<kBatch; b++ )
+  {
+    delete[] forceBatch[b];
+
+    MEMORY::memo.Delete( estifmBatch[b] );
+  }
 }
 
 
@@ -137,6 +187,54 @@ int EQS::Coefs( ELEM*    elem,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Batched() returns true, if the coefficients of the element may be computed together
+// with further elements of the same shape by CoefsBatch(); the default is false
+// ---------------------------------------------------------------------------------------
+
+int EQS::Batched( ELEM* elem )
+{
+  return false;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// compute the coefficients of nb elements (nb <= kBatch) into the batch of element
+// matrices estifm[b] and force vectors force[b]; the default evaluates Coefs()
+// for each element in turn
+// ---------------------------------------------------------------------------------------
+
+void EQS::CoefsBatch( int       nb,
+                      ELEM**    elem,
+                      PROJECT*  project,
+                      double*** estifm,
+                      double**  force )
+{
+  for( int b=0; b<nb; b++ )  Coefs( elem[b], project, estifm[b], force[b] );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// MulVecFD() approximates the product r = A * x of the Newton matrix by finite differences
+// of residuals (Jacobian-free Newton-Krylov, see flag jfnk); there is no default
+// ---------------------------------------------------------------------------------------
+
+void EQS::MulVecFD( double* x, double* r, PROJECT* project )
+{
+  REPORT::rpt.Error( kParameterFault, "Jacobian-free products not supported - EQS::MulVecFD(1)" );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Auxiliary() derives element values from the element force vector, when they have been
+// requested with the flag auxiliary (see CRSMAT::Assemble); the default does nothing
+// ---------------------------------------------------------------------------------------
+
+void EQS::Auxiliary( ELEM* elem, PROJECT* project, double* force )
+{
+}
+
+
 int EQS::GetEqno( NODE* node, int no )
 {
   return nodeEqno[no][node->Getno()];
@@ -151,6 +249,28 @@ int EQS::GetEqno( ELEM* elem, int no )
 }
 
 
+// ---------------------------------------------------------------------------------------
+// equation numbers of the index matrix; with stable equation numbers these include the
+// masked equations of dry nodes and fixed values (see EQS::SetStableEqno)
+
+int EQS::GetIndexEqno( NODE* node, int no )
+{
+  if( !stable )  return GetEqno( node, no );
+
+  return stableNode[no][node->Getno()];
+}
+
+
+int EQS::GetIndexEqno( ELEM* elem, int no )
+{
+  if( !stable )  return GetEqno( elem, no );
+
+  if( isFS(elem->flag, ELEM::kBound) )  return -1;
+
+  return stableElem[no][elem->Getno()];
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 
 void EQS::ExportIM( const char* filename, CRSMAT* crsm, PROJECT* project )
@@ -59,6 +59,15 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.200x    sc     first implementation / first concept
+//  19.10.2026    ag     element coefficients in batches of kBatch elements of the
+//                       same shape: Batched(), CoefsBatch()
+//  19.10.2026    ag     WarmStart(): scaled non-zero initial guess for iterative solvers
+//  19.10.2026    ag     localFac: element factors for local pseudo time steps
+//  19.10.2026    ag     Forcing(): adaptive tolerance of iterative solvers (Eisenstat-Walker)
+//  19.10.2026    ag     jfnk: Jacobian-free products of iterative solvers (MulVecFD)
+//  19.10.2026    ag     auxiliary: element values derived in the element pass (Auxiliary)
+//  19.10.2026    ag     crsmScale: scaling of the matrix kept for further right hand sides
+//  19.10.2026    ag     stable: equation numbers kept over drying and rewetting (SetStableEqno)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -82,12 +91,32 @@ class CRSMAT;
 
 class EQS
 {
+  public:
+    enum { kBatch = kBatchLanes };      // number of elements in a batch of coefficients (Defs.h)
+
   protected:
     int**           nodeEqno;           // array of node equation numbers
     int**           elemEqno;           // array of element equation numbers
 
     int             iterCountCG;        // total counter for CG iterations
 
+    double*         localFac;           // element factors of inverse relaxation time
+                                        // (local pseudo time steps; NULL: global)
+
+    double          eta;                // forcing term of inexact Newton iteration
+    double          etaNorm;            // nonlinear residual of previous iteration
+
+    double*         jfnkForce;          // residual at the actual state (not scaled)
+    double          jfnkScale;          // scaling factor of the right hand side
+
+    double          crsmScale;          // scaling factor of the matrix (ScaleL2Norm)
+
+    int             stableNeq;          // number of stable equations (0: not set up)
+    int             stableDf[3];        // equations at corner nodes, midside nodes and
+                                        // elements of the stable numbering
+    int**           stableNode;         // stable node and element equation numbers
+    int**           stableElem;
+
   public:
     int             dfcn;               // degree of freedom at corner nodes
     int             dfmn;               // degree of freedom at midside nodes
@@ -98,12 +127,28 @@ class EQS
     double*         force;              // element force vector
     double**        estifm;             // element stiffness matrix
 
+    double*         forceBatch[kBatch];  // batch of element force vectors and...
+    double**        estifmBatch[kBatch]; // ...stiffness matrices (CoefsBatch)
+
     int             modelInit;          // set to the counter "model->init" and
                                         // used to initialize the model structure
     EQS*            next;               // used in createEquation
 
     int             initStructure;      // flag to initialize the index matrix
 
+    int             auxiliary;          // derive auxiliary element values in the
+                                        // element pass of EQS::Solve (Auxiliary)
+
+    int             stable;             // stable equation numbers over all nodes and
+                                        // elements of the region; dry nodes and fixed
+                                        // values are kept as identity rows (SetEqno)
+    int             nmask;              // number of identity rows...
+    int*            mask;               // ...and their equation numbers
+
+    int             jfnk;               // Jacobian-free Newton-Krylov: matrix-vector
+                                        // products by finite differences (MulVecFD);
+                                        // the matrix serves as preconditioner only
+
     NODE**          eqnoNode;           // list of node pointers to determine the
                                         // corresponding node of an equation number
     int*            eqid;               // index of equation at node (0,1,2,...)
@@ -133,6 +178,8 @@ class EQS
 
     int          GetEqno( NODE*, int );
     int          GetEqno( ELEM*, int );
+    int          GetIndexEqno( NODE*, int );
+    int          GetIndexEqno( ELEM*, int );
 
     void         ExportIM( const char* filename, CRSMAT* crsm, PROJECT* project );
     void         ExportEQS( const char* filename, CRSMAT* crsm, PROJECT* project );
@@ -155,18 +202,27 @@ class EQS
 
     // SetEqno.cpp -----------------------------------------------------------------------
     void         SetEqno( MODEL*, int, int, int, unsigned int*, int );
+    void         SetStableEqno( MODEL*, int, int, int, unsigned int* );
     void         LastEquation( MODEL*, long );
     void         ResetEqOrder( MODEL* );
 
     // Solve.cpp -------------------------------------------------------------------------
     int          Solve( MODEL* model, int neq, double* rhs, double* x, PROJECT* project,
                         SOLVER* solver=NULL, PRECON** precon=NULL, int assemble=true );
+    double       WarmStart( PROJECT* project, double* rhs, double* x );
+    void         Forcing( PROJECT* project, double norm );
+
+    virtual void MulVecFD( double* x, double* r, PROJECT* project );
+    virtual void Auxiliary( ELEM* elem, PROJECT* project, double* force );
 
     // Update.cpp ------------------------------------------------------------------------
     void         Update( MODEL*,SUBDOM*,double*,int,int,double*,double*,double*,double*,int*,int* );
 
     // -----------------------------------------------------------------------------------
     virtual int  Coefs( ELEM*, PROJECT*, double**, double* );
+
+    virtual int  Batched( ELEM* );
+    virtual void CoefsBatch( int, ELEM**, PROJECT*, double***, double** );
 };
 
 #endif
@@ -41,6 +41,8 @@
 #include "Elem.h"
 #include "Model.h"
 #include "Project.h"
+#include "CRSMat.h"
+#include "Precon.h"
 
 #include "EqsBL2D.h"
 
@@ -132,7 +134,8 @@ void EQS_BL2D::Execute( PROJECT* project, int shape )
       coefs = kQuadratic;
     }
 
-    initStructure = true;
+    // the structure of the equation system is kept for further sub steps ---------------
+    if( sed->subStep == 0 )  initStructure = true;
 
     // allocate some temporary used arrays -----------------------------------------------
     //      B = right hand side of equation system
@@ -144,84 +147,148 @@ void EQS_BL2D::Execute( PROJECT* project, int shape )
     // set boundary conditions -----------------------------------------------------------
     sed->Bcon( project, model );
 
-    // initialize qb ---------------------------------------------------------------------
-    for( int n=0; n<rgnp; n++ )
-    {
-      NODE* nd = rg->Getnode(n);
-      int   no = nd->Getno();
+    // -----------------------------------------------------------------------------------
+    // solve loading law equation for the total load or for each grain fraction; the
+    // matrix depends on the flow only (PLs, sx, sy): it is assembled and factorized for
+    // the first fraction and solved with the right hand sides of further fractions
+
+    int     nk     = 1;
+    double* qbc    = sed->qbc;
+    PRECON* precon = NULL;
+    double  minQb  = sed->minQb;
 
-      nd->v.Qb  = sed->qbc[no];
-      nd->fixqb = false;
+    if( sed->nfrac > 1 )
+    {
+      nk    = sed->nfrac;
+      minQb = 0.0;
     }
 
-    // -----------------------------------------------------------------------------------
-    // solve loading law equation
-    for( int n=0; n<rgnp; n++ )  X[n] = 0.0;
+    for( int k=0; k<nk; k++ )
+    {
+      char var[12] = "qb";                  // "q" and the fraction number
 
-    diverged_cg = Solve( model, neq, B, X, project );
+      if( nk > 1 )
+      {
+        sed->frac = k;
+        sed->qbc  = sed->qbk[k];
 
-    // statistics of correction vector ---------------------------------------------------
-    sprintf( text, "\n\n%-25s%s\n\n %s\n\n",
-                  " (EQS_BL2D::Execute)", "convergence parameters ...",
-                  " variable   node          average        maximum" );
-    REPORT::rpt.Message( 1, text );
+        snprintf( var, sizeof(var), "q%d", k+1 );
+      }
 
-    Update( model, &project->subdom,
-            X, 0, kVarQb, &maxAbs, &maxPer, &avAbs, &avPer, &noAbs, &noPer );
+      // initialize qb -------------------------------------------------------------------
+      for( int n=0; n<rgnp; n++ )
+      {
+        NODE* nd = rg->Getnode(n);
+        int   no = nd->Getno();
 
-    sprintf( text, "      %2s    %7d     %12.5le   %12.5le %s\n",
-                  "qb", noAbs, avAbs, maxAbs, "     (abs)" );
-    REPORT::rpt.Message( 1, text );
+        nd->v.Qb  = sed->qbc[no];
+        nd->fixqb = false;
+      }
 
-    sprintf( text, "      %2s    %7d     %12.5lf   %12.5lf %s\n\n",
-                  "  ", noPer, avPer, maxPer, "     ( %% )" );
-    REPORT::rpt.Message( 1, text );
+      // ---------------------------------------------------------------------------------
+      // solve loading law equation
+      for( int n=0; n<rgnp; n++ )  X[n] = 0.0;
 
-    // update node variables -------------------------------------------------------------
-    for( int n=0; n<rgnp; n++ )
-    {
-      NODE* nd = rg->Getnode(n);
-      int   no = nd->Getno();
-      int eqno = GetEqno( nd, 0 );
+      diverged_cg = Solve( model, neq, B, X, project, NULL, &precon, k == 0 );
 
-      nd->v.Qb += X[eqno];
-    }
+      // statistics of correction vector -------------------------------------------------
+      sprintf( text, "\n\n%-25s%s\n\n %s\n\n",
+                    " (EQS_BL2D::Execute)", "convergence parameters ...",
+                    " variable   node          average        maximum" );
+      REPORT::rpt.Message( 1, text );
 
-    // -----------------------------------------------------------------------------------
-    for( int n=0; n<rgnp; n++ )
-    {
-      NODE* nd = rg->Getnode(n);
-      int   no = nd->Getno();
+      Update( model, &project->subdom,
+              X, 0, kVarQb, &maxAbs, &maxPer, &avAbs, &avPer, &noAbs, &noPer );
+
+      sprintf( text, "      %2s    %7d     %12.5le   %12.5le %s\n",
+                    var, noAbs, avAbs, maxAbs, "     (abs)" );
+      REPORT::rpt.Message( 1, text );
 
-      // check for minimum allowed transport capacity ... --------------------------------
-      if( nd->v.Qb < sed->minQb )
+      sprintf( text, "      %2s    %7d     %12.5lf   %12.5lf %s\n\n",
+                    "  ", noPer, avPer, maxPer, "     ( %% )" );
+      REPORT::rpt.Message( 1, text );
+
+      // update node variables -----------------------------------------------------------
+      for( int n=0; n<rgnp; n++ )
       {
-        nd->v.Qb = 0.0;
+        NODE* nd = rg->Getnode(n);
+        int   no = nd->Getno();
+        int eqno = GetEqno( nd, 0 );
+
+        nd->v.Qb += X[eqno];
       }
-    }
 
-    // interpolate transport rate qb at midside nodes ------------------------------------
-    if( shape == kLinear )
-    {
-      for( int e=0; e<rg->Getne(); e++ )
+      // ---------------------------------------------------------------------------------
+      for( int n=0; n<rgnp; n++ )
       {
-        ELEM* el = rg->Getelem(e);
+        NODE* nd = rg->Getnode(n);
+        int   no = nd->Getno();
 
-        int ncn = el->Getncn();
-        int nnd = el->Getnnd();
+        // check for minimum allowed transport capacity (total load of fractions) ... ----
+        if( nd->v.Qb < minQb )
+        {
+          nd->v.Qb = 0.0;
+        }
+      }
 
-        for( int i=ncn; i<nnd; i++ )
+      // interpolate transport rate qb at midside nodes ----------------------------------
+      if( shape == kLinear )
+      {
+        for( int e=0; e<rg->Getne(); e++ )
         {
-          int il, ir;
-          el->GetQShape()->getCornerNodes( i, &il, &ir );
+          ELEM* el = rg->Getelem(e);
 
-          NODE* ndm = el->Getnode(i);
-          NODE* ndl = el->Getnode(il);
-          NODE* ndr = el->Getnode(ir);
+          int ncn = el->Getncn();
+          int nnd = el->Getnnd();
 
-          ndm->v.Qb = 0.5 * (ndl->v.Qb + ndr->v.Qb);
+          for( int i=ncn; i<nnd; i++ )
+          {
+            int il, ir;
+            el->GetQShape()->getCornerNodes( i, &il, &ir );
+
+            NODE* ndm = el->Getnode(i);
+            NODE* ndl = el->Getnode(il);
+            NODE* ndr = el->Getnode(ir);
+
+            ndm->v.Qb = 0.5 * (ndl->v.Qb + ndr->v.Qb);
+          }
         }
       }
+
+      // copy computed non-equilibrium transport capacity to sed->qbc[] ------------------
+      for( int n=0; n<rgnp; n++ )
+      {
+        NODE* nd = rg->Getnode(n);
+        int   no = nd->Getno();
+
+        sed->qbc[no] = nd->v.Qb;
+      }
+    }
+
+    delete precon;
+
+    sed->frac = -1;
+    sed->qbc  = qbc;
+
+    // total load of grain fractions -----------------------------------------------------
+    if( nk > 1 )
+    {
+      for( int n=0; n<rgnp; n++ )
+      {
+        NODE* nd = rg->Getnode(n);
+        int   no = nd->Getno();
+
+        qbc[no] = 0.0;
+        for( int k=0; k<nk; k++ )  qbc[no] += sed->qbk[k][no];
+
+        if( qbc[no] < sed->minQb )
+        {
+          qbc[no] = 0.0;
+          for( int k=0; k<nk; k++ )  sed->qbk[k][no] = 0.0;
+        }
+
+        nd->v.Qb = qbc[no];
+      }
     }
 
     // finalizing ------------------------------------------------------------------------
@@ -232,14 +299,5 @@ void EQS_BL2D::Execute( PROJECT* project, int shape )
                     " (EQS_BL2D::Execute)",
                     "non-equilibrium bedload transport rates determined" );
     REPORT::rpt.Output( text, 1 );
-
-    // copy computed non-equilibrium transport capacity to sed->qbc[] --------------------
-    for( int n=0; n<rgnp; n++ )
-    {
-      NODE* nd = rg->Getnode(n);
-      int   no = nd->Getno();
-
-      sed->qbc[no] = nd->v.Qb;
-    }
   }
 }
@@ -53,6 +53,10 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  11.04.2005    sc    first implementation / first concept
+//  19.10.2026    ag    Region() dispatches to kernels specialised for the number of
+//                      element nodes (template Region<nnd>)
+//  19.10.2026    ag    structure of equations kept for bed load sub steps
+//  19.10.2026    ag    grain fractions solved with the same matrix and preconditioner
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -91,6 +95,8 @@ class EQS_BL2D : public EQS
 
     void Bound( ELEM*, PROJECT*, double**, double*, SHAPE* );
     void Region( ELEM*, PROJECT*, double**, double*, SHAPE* );
+    template< int kNnd >
+    void Region( ELEM*, PROJECT*, double**, double*, SHAPE* );
 
 //    void BoundDiffusion( ELEM*, PROJECT*, double**, double*, SHAPE* );
 //    void RegionDiffusion( ELEM*, PROJECT*, double**, double*, SHAPE* );
@@ -41,6 +41,8 @@
 #include "Elem.h"
 #include "Model.h"
 #include "Project.h"
+#include "CRSMat.h"
+#include "Precon.h"
 
 #include "EqsDz.h"
 
@@ -90,6 +92,11 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
 
   for( int n=0; n<rgnp; n++ )  etaQb[n] = 1.0;
 
+  // bed evolution of grain fractions (Finite-Elements) ----------------------------------
+  double* dzdtk[SED::kMaxFrac];
+
+  for( int k=0; k<SED::kMaxFrac; k++ )  dzdtk[k] = NULL;
+
   ////////////////////////////////////////////////////////////////////////////////////////
   // solve bottom evolution equation iteratively ...
 
@@ -398,19 +405,27 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
 
       SetEqno( model, 1, 0, 0, project->fix, project->elemKind );
 
+      // the structure of the equation system is kept for further sub steps ------------
+      if( sed->subStep == 0 )  initStructure = true;
+
       if( shape == kLinear )  coefs = kBottomEvol_L;
       else                    coefs = kBottomEvol;
 
       double* B = (double*) MEMORY::memo.Array_eq( neq );      // right hand side
       double* X = (double*) MEMORY::memo.Array_eq( neq );      // change of Z
 
-      initStructure = true;
+      PRECON* precon = NULL;
 
       for( int it=0; it<project->actualCycit; it++ )
       {
         for( int e=0; e<neq; e++ )  X[e] = 0.0;
+
+        // the preconditioner of the last iteration is kept for grain fractions ----------
+        delete precon;
+        precon = NULL;
+
         // solve equation system ---------------------------------------------------------
-        diverged_cg = Solve( model, neq, B, X, project );
+        diverged_cg = Solve( model, neq, B, X, project, NULL, &precon );
 
         // copy solution to dzdt ---------------------------------------------------------
         for( int n=0; n<rgnp; n++ )
@@ -495,6 +510,62 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
         if( maxAbs < 1.0e-6 )  break;
       }
 
+      // ---------------------------------------------------------------------------------
+      // bed change of grain fractions: the matrix does not depend on the transport rate;
+      // the matrix and preconditioner of the last iteration are solved with the right
+      // hand sides of all fractions, starting from dzdt = 0 with the final etaQb
+      if( sed->nfrac > 1 )
+      {
+        double* dzdtTot = dzdt;
+        double* qbTot   = (double*) MEMORY::memo.Array_nd( rgnp );
+
+        for( int n=0; n<rgnp; n++ )
+        {
+          NODE* nd = rg->Getnode(n);
+          qbTot[nd->Getno()] = nd->v.Qb;
+        }
+
+        for( int k=0; k<sed->nfrac; k++ )
+        {
+          dzdtk[k] = (double*) MEMORY::memo.Array_nd( rgnp );
+          for( int n=0; n<rgnp; n++ )  dzdtk[k][n] = 0.0;
+
+          dzdt      = dzdtk[k];
+          sed->frac = k;
+
+          for( int n=0; n<rgnp; n++ )
+          {
+            NODE* nd = rg->Getnode(n);
+            nd->v.Qb = sed->qbk[k][nd->Getno()];
+          }
+
+          for( int e=0; e<neq; e++ )  X[e] = 0.0;
+
+          diverged_cg = Solve( model, neq, B, X, project, NULL, &precon, false );
+
+          for( int n=0; n<rgnp; n++ )
+          {
+            NODE* nd = rg->Getnode(n);
+            int eqno = GetEqno( nd, 0 );
+
+            if( eqno >= 0 )  dzdtk[k][nd->Getno()] = X[eqno];
+          }
+        }
+
+        dzdt      = dzdtTot;
+        sed->frac = -1;
+
+        for( int n=0; n<rgnp; n++ )
+        {
+          NODE* nd = rg->Getnode(n);
+          nd->v.Qb = qbTot[nd->Getno()];
+        }
+
+        MEMORY::memo.Detach( qbTot );
+      }
+
+      delete precon;
+
       MEMORY::memo.Detach( B );
       MEMORY::memo.Detach( X );
 
@@ -517,6 +588,8 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
   ////////////////////////////////////////////////////////////////////////////////////////
 
   // change bottom elevation -------------------------------------------------------------
+  double maxDz = 0.0;
+
   for( int n=0; n<rgnp; n++ )
   {
     NODE* nd = rg->Getnode(n);
@@ -524,6 +597,8 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
 
     if( isFS(nd->flag, NODE::kCornNode) )
     {
+      if( fabs(dzdt[no]*dt) > maxDz )  maxDz = fabs( dzdt[no] * dt );
+
       nd->zor += dzdt[no] * dt;
 
       if( nd->zor < nd->zero )
@@ -537,6 +612,22 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
     }
   }
 
+  // bed change since the last flow solution (SED::skipFlow) -----------------------------
+# ifdef _MPI_
+  maxDz = subdom->Mpi_max( maxDz );
+# endif
+
+  if( sed->sumDz < 0.0 )  sed->sumDz = 0.0;
+  sed->sumDz += maxDz;
+
+  // composition of the active layer -----------------------------------------------------
+  if( dzdtk[0] )
+  {
+    sed->Composition( project, model, dzdt, dzdtk, dt );
+
+    for( int k=0; k<sed->nfrac; k++ )  MEMORY::memo.Detach( dzdtk[k] );
+  }
+
   // set NODE::qb[] ----------------------------------------------------------------------
   for( int n=0; n<rgnp; n++ )
   {
@@ -544,6 +635,11 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
     int   no = nd->Getno();
 
     nd->v.Qb *= etaQb[no];
+
+    if( sed->nfrac > 1 )
+    {
+      for( int k=0; k<sed->nfrac; k++ )  sed->qbk[k][no] *= etaQb[no];
+    }
   }
 
   // interpolate bed elevation at midside nodes ------------------------------------------
@@ -576,6 +672,13 @@ void EQS_DZ::Execute( PROJECT* project, int shape )
   REPORT::rpt.Message( 1, "\n%-25s%s %12.3lf [s]\n",
                           " (EQS_DZ::Execute)", "morphological time step =",
                           project->timeint.incTime.Getsec() );
+
+  if( sed->morFac != 1.0  ||  sed->subSteps > 1 )
+  {
+    REPORT::rpt.Message( 1, "%-25s%s %12.3lf [s]  (sub step %d of %d)\n",
+                            " ", "bed evolution time      =",
+                            dt, sed->subStep+1, sed->subSteps );
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -713,8 +816,14 @@ double EQS_DZ::MorphTime( PROJECT* project, int n, double* dz )
 # endif
   ////////////////////////////////////////////////////////////////////////////////////////
 
+  // time step of further sub steps is given by the first one --------------------------
+  SED* sed = &project->sed;
+
+  if( sed->subStep > 0 )  return tmint->incTime.Getsec() * sed->morFac / sed->subSteps;
+
   // determine morphological time step ---------------------------------------------------
-  double dt = project->sed.maxDz / maxdzdt;
+  // the bed change of one sub step must not exceed maxDz: sub steps * morFac * dt * dz/dt
+  double dt = sed->subSteps * sed->maxDz / sed->morFac / maxdzdt;
 
   if( dt < tmint->relaxTimeFlow.Getsec() )  dt = tmint->relaxTimeFlow.Getsec();
   if( dt > 1.5 * tmint->incTime.Getsec() )  dt = 1.5 * tmint->incTime.Getsec();
@@ -737,7 +846,8 @@ double EQS_DZ::MorphTime( PROJECT* project, int n, double* dz )
     dt = tmint->incTime.Getsec();
   }
 
-  return dt;
+  // return time of bed evolution for the sub step ---------------------------------------
+  return dt * sed->morFac / sed->subSteps;
 }
 
 
@@ -856,6 +966,9 @@ void EQS_DZ::QbDiff( PROJECT* project, int shape )
                   factDzQb * maxDz );
   REPORT::rpt.Message( 1, text );
 
+  if( sed->sumDz < 0.0 )  sed->sumDz = 0.0;
+  sed->sumDz += fabs( factDzQb * maxDz );
+
 
   for( int n=0; n<rgnp; n++ )
   {
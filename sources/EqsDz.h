@@ -54,6 +54,10 @@
 // ------------  ----  -----------------------------------------------------------------------------
 //  11.05.2005    sc    first implementation / first concept
 //  05.05.2006    sc    splitting bottom evolution from bed load module
+//  19.10.2026    ag    morphological factor and sub steps in MorphTime(), structure of
+//                      equations kept for sub steps (SED::morFac, SED::subSteps)
+//  19.10.2026    ag    bed change of grain fractions with the matrix and preconditioner
+//                      of the total bed change; composition of the active layer
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,11 +50,17 @@ EQS_KD2D::EQS_KD2D() : EQS( 2, 2, 2 )
   neq  = 0;
   cbuf = NULL;
   cent = NULL;
+
+  changeKD = -1.0;
+  skipped  = 0;
+  npGrad   = 0;
+  grad     = NULL;
 }
 
 
 EQS_KD2D::~EQS_KD2D()
 {
+  if( grad )  delete[] grad;
 }
 
 
@@ -101,6 +107,12 @@ void EQS_KD2D::Execute( PROJECT* project, int steadyFlow, int shape )
   project->PrintTheCycle( 1 );
   REPORT::rpt.PrintTime( 1 );
 
+  // skip the cycle in stationary flow, if K, D and the velocity gradients have not
+  // changed significantly since the last computed cycle ---------------------------------
+  int skipKD = steadyFlow  &&  project->skipKD > 0.0;
+
+  if( skipKD  &&  Skip(project) )  return;
+
   // set parameters according to time integration and relaxation -------------------------
   double th = project->timeint.thetaTurb;
   double dt = project->timeint.incTime.Getsec();
@@ -270,6 +282,37 @@ void EQS_KD2D::Execute( PROJECT* project, int steadyFlow, int shape )
   }
 
 
+  // -------------------------------------------------------------------------------------
+  // local pseudo time steps in time relaxed stationary computations
+
+  localFac = NULL;
+
+  if( steadyFlow  &&  relaxMethod >= 3  &&  project->relaxLocal > 1.0 )
+  {
+    localFac = (double*) MEMORY::memo.Array_el( rg->Getne() );
+    rg->LocalTime( project, localFac, true );
+  }
+
+
+  // -------------------------------------------------------------------------------------
+  // K and D at the start of the cycle to determine their change (see Skip())
+
+  double* K0 = NULL;
+  double* D0 = NULL;
+
+  if( skipKD )
+  {
+    K0 = (double*) MEMORY::memo.Array_nd( rg->Getnp() );
+    D0 = (double*) MEMORY::memo.Array_nd( rg->Getnp() );
+
+    for( int n=0; n<rg->Getnp(); n++ )
+    {
+      K0[n] = rg->Getnode(n)->v.K;
+      D0[n] = rg->Getnode(n)->v.D;
+    }
+  }
+
+
   // -------------------------------------------------------------------------------------
   // iteration loop
 
@@ -1133,6 +1176,85 @@ void EQS_KD2D::Execute( PROJECT* project, int steadyFlow, int shape )
   }
 
 
+  // -------------------------------------------------------------------------------------
+  // relative change of K and D in this cycle; optionally the changes are smoothed in the
+  // region, where they are larger than the limit project->skipKD
+
+  if( skipKD )
+  {
+    double dK   = 0.0;
+    double dD   = 0.0;
+    double maxK = 0.0;
+    double maxD = 0.0;
+
+    for( int i=0; i<np; i++ )
+    {
+      int no = node[i]->Getno();
+
+      if( fabs(node[i]->v.K - K0[no]) > dK )  dK = fabs(node[i]->v.K - K0[no]);
+      if( fabs(node[i]->v.D - D0[no]) > dD )  dD = fabs(node[i]->v.D - D0[no]);
+
+      if( fabs(node[i]->v.K) > maxK )  maxK = fabs(node[i]->v.K);
+      if( fabs(node[i]->v.D) > maxD )  maxD = fabs(node[i]->v.D);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////
+    // MPI: broadcast statistic
+#   ifdef _MPI_
+    dK   = project->subdom.Mpi_max( dK );
+    dD   = project->subdom.Mpi_max( dD );
+    maxK = project->subdom.Mpi_max( maxK );
+    maxD = project->subdom.Mpi_max( maxD );
+#   endif
+    //////////////////////////////////////////////////////////////////////////////////////
+
+    changeKD = 0.0;
+    if( maxK > 0.0  &&  dK / maxK > changeKD )  changeKD = dK / maxK;
+    if( maxD > 0.0  &&  dD / maxD > changeKD )  changeKD = dD / maxD;
+
+    REPORT::rpt.Message( 2, "\n%-25s%s %12.5le\n\n",
+                            " (EQS_KD2D::Execute)", "relative change of K and D =", changeKD );
+
+    // smoothing is applied to the changes, not to K and D: in converged regions and in
+    // the steady state (no changes) K and D are left untouched
+    if( project->smoothPassesKD > 0 )
+    {
+      char* mark = (char*) MEMORY::memo.Array_nd( rg->Getnp() );
+
+      for( int n=0; n<rg->Getnp(); n++ )
+      {
+        NODE* nd = rg->Getnode(n);
+
+        nd->v.K -= K0[n];
+        nd->v.D -= D0[n];
+
+        mark[n] = fabs(nd->v.K) > project->skipKD * maxK
+               || fabs(nd->v.D) > project->skipKD * maxD;
+      }
+
+      rg->SmoothKD( project->smoothPassesKD, mark );
+
+      for( int n=0; n<rg->Getnp(); n++ )
+      {
+        NODE* nd = rg->Getnode(n);
+
+        nd->v.K += K0[n];
+        nd->v.D += D0[n];
+      }
+
+      Validate( project, np, node );
+
+      MEMORY::memo.Detach( mark );
+    }
+
+    // only converged cycles may be followed by skipped ones
+    if( !conv )  changeKD = -1.0;
+
+    MEMORY::memo.Detach( K0 );
+    MEMORY::memo.Detach( D0 );
+  }
+
+
   // -------------------------------------------------------------------------------------
   // finally:
   // compute eddy viscosity from revised turbulence parameters
@@ -1152,6 +1274,12 @@ void EQS_KD2D::Execute( PROJECT* project, int steadyFlow, int shape )
   if( cxKo ) MEMORY::memo.Detach( cxKo );
   if( cxDo ) MEMORY::memo.Detach( cxDo );
 
+  if( localFac )
+  {
+    MEMORY::memo.Detach( localFac );
+    localFac = NULL;
+  }
+
 
   // -------------------------------------------------------------------------------------
 
@@ -1160,6 +1288,106 @@ void EQS_KD2D::Execute( PROJECT* project, int steadyFlow, int shape )
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Decide whether the cycle is skipped in stationary flow: the last computed cycle has
+// converged with a relative change of K and D less than project->skipKD and the relative
+// change of the velocity gradients since then is less than project->skipKD, too. At most
+// project->maxSkipKD cycles are skipped in a row. The velocity gradients are measured by
+// G = sqrt( 2 Ux^2 + 2 Vy^2 + (Uy + Vx)^2 ), which drives the production of K.
+//////////////////////////////////////////////////////////////////////////////////////////
+
+int EQS_KD2D::Skip( PROJECT* project )
+{
+  GRID* rg   = project->M2D->region;
+  int   rgnp = rg->Getnp();
+
+  if( npGrad != rgnp )
+  {
+    if( grad )  delete[] grad;
+
+    grad = new double [rgnp];
+
+    if( !grad )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS_KD2D::Skip(1)" );
+
+    npGrad   = rgnp;
+    changeKD = -1.0;
+  }
+
+  double* dUdx = (double*) MEMORY::memo.Array_nd( rgnp );
+  double* dUdy = (double*) MEMORY::memo.Array_nd( rgnp );
+  double* dVdx = (double*) MEMORY::memo.Array_nd( rgnp );
+  double* dVdy = (double*) MEMORY::memo.Array_nd( rgnp );
+
+  for( int n=0; n<rgnp; n++ )  dUdx[n] = dUdy[n] = dVdx[n] = dVdy[n] = 0.0;
+
+  rg->VeloGrad( project, dUdx, dUdy, dVdx, dVdy );
+
+
+  // maximum change of G related to the maximum of G; G is stored in dUdx[] --------------
+
+  double dG   = 0.0;
+  double maxG = 0.0;
+
+  for( int n=0; n<rgnp; n++ )
+  {
+    double Ux = dUdx[n];
+    double Uy = dUdy[n];
+    double Vx = dVdx[n];
+    double Vy = dVdy[n];
+
+    double G  = sqrt( 2.0*Ux*Ux + 2.0*Vy*Vy + (Uy + Vx)*(Uy + Vx) );
+
+    if( changeKD >= 0.0  &&  fabs(G - grad[n]) > dG )  dG = fabs(G - grad[n]);
+    if( G > maxG )  maxG = G;
+
+    dUdx[n] = G;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////
+  // MPI: broadcast statistic
+# ifdef _MPI_
+  dG   = project->subdom.Mpi_max( dG );
+  maxG = project->subdom.Mpi_max( maxG );
+# endif
+  //////////////////////////////////////////////////////////////////////////////////////
+
+  double change = 0.0;
+  if( maxG > 0.0 )  change = dG / maxG;
+
+  int skip =     changeKD >= 0.0
+             &&  changeKD < project->skipKD
+             &&  change   < project->skipKD
+             &&  skipped  < project->maxSkipKD;
+
+  if( skip )
+  {
+    skipped++;
+
+    REPORT::rpt.Message( 1, "\n%-25s%s %12.5le\n%-25s%s %12.5le\n\n",
+                            " (EQS_KD2D::Skip)", "cycle skipped, change of K and D =", changeKD,
+                            " ",                 "    change of velocity gradients =", change );
+  }
+  else
+  {
+    REPORT::rpt.Message( 2, "\n%-25s%s %12.5le\n%-25s%s %12.5le\n\n",
+                            " (EQS_KD2D::Skip)", "cycle computed, change of K and D =", changeKD,
+                            " ",                 "     change of velocity gradients =", change );
+
+    skipped = 0;
+
+    for( int n=0; n<rgnp; n++ )  grad[n] = dUdx[n];
+  }
+
+  MEMORY::memo.Detach( dUdx );
+  MEMORY::memo.Detach( dUdy );
+  MEMORY::memo.Detach( dVdx );
+  MEMORY::memo.Detach( dVdy );
+
+  return skip;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Check KD-values for validity (>= 0).
 //////////////////////////////////////////////////////////////////////////////////////////
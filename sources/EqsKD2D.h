@@ -58,6 +58,11 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1992    sc    first implementation / first concept
+//  19.10.2026    ag    Region() dispatches to kernels specialised for 6-node triangles
+//                      and 8-node quadrilaterals (template Region<nnd,ncn>)
+//  19.10.2026    ag    local pseudo time steps in time relaxed stationary computations
+//  19.10.2026    ag    Skip(): cycles in stationary flow are skipped for small changes
+//                      of K, D and the velocity gradients
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +91,11 @@ class EQS_KD2D : public EQS
     NODE*   cbuf;
     NODE**  cent;
 
+    double  changeKD;       // relative change of K and D in the last computed cycle
+    int     skipped;        // number of cycles skipped in a row
+    int     npGrad;
+    double* grad;           // velocity gradients at the last computed cycle
+
   public:
     EQS_KD2D();
     ~EQS_KD2D();
@@ -94,6 +104,8 @@ class EQS_KD2D : public EQS
     int  Coefs( ELEM*, PROJECT*, double**, double* );
 
   protected:
+    void Region( ELEM*, PROJECT*, double**, double* );
+    template< int kNnd, int kNcn >
     void Region( ELEM*, PROJECT*, double**, double* );
     void RegionAI( ELEM*, PROJECT*, double**, double* );
 
@@ -104,6 +116,7 @@ class EQS_KD2D : public EQS
     void RegionQAI( ELEM*, PROJECT*, double**, double* );
 
     void Validate( PROJECT*, int, NODE**, int =0, NODE** =NULL, ELEM** =NULL );
+    int  Skip( PROJECT* );
 };
 
 #endif
@@ -40,6 +40,8 @@
 #include "Elem.h"
 #include "Model.h"
 #include "Project.h"
+#include "CRSMat.h"
+#include "Precon.h"
 
 #include "EqsUVS2D.h"
 
@@ -50,11 +52,23 @@
 EQS_UVS2D::EQS_UVS2D() : EQS( 3, 2, 0 )
 {
   neq = 0;
+
+  batchCoefs = true;
+
+  histNp   = 0;
+  predTime = 0.0;
+  predDt   = 0.0;
+  histUVS  = NULL;
+  histCnt  = NULL;
+
+  contErr = NULL;
 }
 
 
 EQS_UVS2D::~EQS_UVS2D()
 {
+  delete[] histUVS;
+  delete[] histCnt;
 }
 
 
@@ -139,6 +153,25 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
     relaxThdt_UV = 1.0 / dt_UV / th;
   }
 
+  // local pseudo time steps in time relaxed stationary computations --------------------
+  localFac = NULL;
+
+  if( steadyFlow  &&  relaxMethod >= 3  &&  project->relaxLocal > 1.0 )
+  {
+    localFac = (double*) MEMORY::memo.Array_el( rg->Getne() );
+  }
+
+  // continuity errors of elements, derived in the element pass of EQS::Solve() ---------
+  contErr = NULL;
+
+  if( project->contErr )
+  {
+    contErr = (double*) MEMORY::memo.Array_el( rg->Getne() );
+    for( int e=0; e<rg->Getne(); e++ )  contErr[e] = 0.0;
+
+    auxiliary = true;
+  }
+
   // write a note, if dispersion model is active -----------------------------------------
   if( project->actualDisp > 0 )
   {
@@ -167,6 +200,7 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
   int     nextDW   = 0;
 
   int     eddy     = true;
+  int     warm     = false;
 
   double  theNorm  = -1.0;
   double  relax    =  1.0;
@@ -175,13 +209,63 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
 
   int     maxit    = project->actualCycit;
 
+  int     bconInit = -1;
+  double  bconTime = 0.0;
+
   double  last_dt  = dt_H;
 
+  Forcing( project, 0.0 );
+
+  // Jacobian-free Newton-Krylov: the assembled matrix and its preconditioner are kept
+  // for project->jfnkLag iterations; products with the Jacobian by finite differences
+
+  PRECON* precon   = NULL;
+  int     jfnkAge  = 0;
+
+  jfnk = false;
+
+  if( project->jfnkLag > 0 )
+  {
+    switch( project->actualSolver->solverType )
+    {
+      case kBicgstab:
+      case kParmsBcgstabd:
+      case kParmsFgmresd:
+        jfnk = true;
+        break;
+    }
+  }
+
+  // stable equation numbers over drying and rewetting with CRS iterative solvers
+  // (see EQS::SetStableEqno); a change of the numbering requires new equation numbers
+
+  int wasStable = stable;
+
+  stable = false;
+
+  if( dryRew->stableEqno  &&  project->subdom.npr == 1 )
+  {
+    switch( project->actualSolver->solverType )
+    {
+      case kBicgstab:
+      case kParmsBcgstabd:
+      case kParmsFgmresd:
+        stable = true;
+        break;
+    }
+  }
+
+  if( stable != wasStable )  modelInit = 0;
+
 
   for( int it=0; it<maxit; it++ )
   {
+    if( !steadyFlow )  project->iterCountNR = it + 1;   // used by adaptive sub steps
+
     if( it == 0 || isFS(project->actualTurb, BCONSET::kVtIterat) )  eddy = true;
 
+    if( it == 0 )  rg->turbChange.Reset();
+
     // print information on actual iteration ---------------------------------------------
     if( REPORT::rpt.level > 1 )
     {
@@ -204,6 +288,7 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
         else                                    DWconv = true;
 
         eddy = true;
+        rg->turbChange.Reset();
 
         if( nextDW > maxit )  // prevent further drying and rewetting
         {
@@ -212,6 +297,21 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
           DWconv = true;
         }
       }
+
+      // in between: check the wet/dry line only ---------------------------------------
+      else if( nextDW >= 0  &&  dryRew->frontFreq > 0  &&  it % dryRew->frontFreq == 0 )
+      {
+        int dry, wet;
+        model->DoDryRewet( project, &dry, &wet, true );
+
+        if( dry || wet )
+        {
+          if( wet )  DWconv = false;
+
+          eddy = true;
+          rg->turbChange.Reset();
+        }
+      }
     }
 /*
     else if( dryRew->method == 0 )
@@ -300,32 +400,61 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
     model->DoFriction( project );
 
     // initialize Reynolds stresses and eddy viscosity -----------------------------------
+    // during NR iterations eddy viscosity is recomputed only, if the flow state of any
+    // node has changed by more than the limits project->changeUV/changeS
     if( eddy )
     {
       eddy = false;
-      rg->Turbulence( project );
+
+      int changed = rg->turbChange.Mark( rg, project->changeUV, project->changeS );
+
+#     ifdef _MPI_
+      changed = project->subdom.Mpi_max( changed );
+#     endif
+
+      if( changed )
+      {
+        rg->Turbulence( project );
+        rg->turbChange.Store( rg );
+      }
     }
 
     // set inflow and outflow condition --------------------------------------------------
+    // the boundary setup is repeated only for a new time level bcTime (the time step may
+    // be reduced in the iterations), after drying and rewetting (model->Getinit()
+    // changed) or if the setup depends on the flow state; otherwise the state dependent
+    // values of discharge inlets and the log law are updated only
+    BCONSET *abcs = project->timeint.actualBcSet;
+
     TIME bcTime = project->timeint.actualTime + project->timeint.incTime;
 
-    project->timeint.actualBcSet->InitBcon( project, &bcTime, &Qout );
+    if(     model->Getinit() != bconInit  ||  bcTime.Getsec() != bconTime
+        ||  abcs->stateDep )
+    {
+      bconInit = model->Getinit();
+      bconTime = bcTime.Getsec();
 
-    // update the iterated difference of the water level for gauge controlled nodes ------
-    BCONSET *abcs = project->timeint.actualBcSet;
+      abcs->InitBcon( project, &bcTime, &Qout );
 
-    if( project->ngct != abcs->ngct )
-    {
-      if( project->ngct > 0 ) delete[] project->gct;
-      project->gct  = new BCVAL::GAUGECT[abcs->ngct];
-      project->ngct = abcs->ngct;
-    }
+      // update the iterated difference of the water level for gauge controlled nodes ----
+      if( project->ngct != abcs->ngct )
+      {
+        if( project->ngct > 0 ) delete[] project->gct;
+        project->gct  = new BCVAL::GAUGECT[abcs->ngct];
+        project->ngct = abcs->ngct;
+      }
+
+      for( int i=0; i<project->ngct; i++ ) project->gct[i] = abcs->gct[i];
 
-    for( int i=0; i<project->ngct; i++ ) project->gct[i] = abcs->gct[i];
+      model->SetLocation();
+      model->SetNormal();
+      model->SetRotation();
+    }
 
-    model->SetLocation();
-    model->SetNormal();
-    model->SetRotation();
+    else
+    {
+      abcs->UpdateBcon( project );
+    }
 
     // set equation numbers --------------------------------------------------------------
     if( model->Getinit() != modelInit )
@@ -340,21 +469,68 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
 
       SetEqno( model, 3, 2, 0, project->fix, project->elemKind );
 
-      initStructure = true;
+      // with stable equation numbers the index matrix is kept; only the preconditioner
+      // of Jacobian-free iterations belongs to the previous set of identity rows
+
+      if( stable )
+      {
+        delete precon;
+        precon = NULL;
+      }
+
+      else
+      {
+        initStructure = true;
+      }
 
       if( X ) MEMORY::memo.Detach( X );
       if( B ) MEMORY::memo.Detach( B );
 
       X = (double*) MEMORY::memo.Array_eq( neq );
       B = (double*) MEMORY::memo.Array_eq( neq );
+
+      warm = false;
     }
 
 
     // solve equations -------------------------------------------------------------------
+    // with warm start the previous correction X is the initial guess of the iterative
+    // solver; it is scaled in EQS::Solve() to minimize the initial residual
+
+    if( !project->warmStart  ||  !warm )  for( int i=0; i<neq; i++ )  X[i] = 0.0;
+
+    if( localFac )  rg->LocalTime( project, localFac, false );
+
+    if( jfnk )
+    {
+      int assemble = true;
+
+      if( precon  &&  !initStructure  &&  !diverged_cg  &&  jfnkAge < project->jfnkLag )
+      {
+        assemble = false;
+      }
+
+      else
+      {
+        delete precon;
+        precon  = NULL;
+        jfnkAge = 0;
+      }
+
+      jfnkAge++;
 
-    for( int i=0; i<neq; i++ )  X[i] = 0.0;
+      REPORT::rpt.Message( 3, "\n%-25s%s %d\n", " (EQS_UVS2D::Execute)",
+                              "Jacobian-free iteration with preconditioner of age", jfnkAge );
 
-    diverged_cg = Solve( model, neq, B, X, project );
+      diverged_cg = Solve( model, neq, B, X, project, NULL, &precon, assemble );
+    }
+
+    else
+    {
+      diverged_cg = Solve( model, neq, B, X, project );
+    }
+
+    warm = true;
 
     //////////////////////////////////////////////////////////////////////////////////////
 #   ifdef kDebug
@@ -436,6 +612,54 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
     NRconv = project->subdom.Mpi_max( NRconv );
 #   endif
 
+    // continuity errors of elements at the state before the correction ----------------
+    if( contErr )
+    {
+      int    cnt   = 0;
+      double avErr = 0.0;
+      double mxErr = 0.0;
+
+      for( int e=0; e<rg->Getne(); e++ )
+      {
+        ELEM* el = rg->Getelem(e);
+
+        if( !isFS(el->flag, ELEM::kRegion)  ||  isFS(el->flag, ELEM::kDry) )  continue;
+
+        double err = fabs( contErr[el->Getno()] );
+
+        avErr += err;
+        cnt++;
+
+        if( err > mxErr )  mxErr = err;
+      }
+
+#     ifdef _MPI_
+      cnt   = project->subdom.Mpi_sum( cnt );
+      avErr = project->subdom.Mpi_sum( avErr );
+      mxErr = project->subdom.Mpi_max( mxErr );
+#     endif
+
+      if( cnt )  avErr /= cnt;
+
+      REPORT::rpt.Message( 2, "\n%-25s%s %14.5le   %14.5le\n",
+                              " ", "continuity error of elements:", avErr, mxErr );
+    }
+
+    // forcing term for the next solution: changes relative to convergence criteria ------
+    if( project->actualSolver->forcing )
+    {
+      double norm = fabs(mxAbs[0]) / project->convUV;
+
+      if( fabs(mxAbs[1]) / project->convUV > norm )  norm = fabs(mxAbs[1]) / project->convUV;
+      if( fabs(mxAbs[2]) / project->convS  > norm )  norm = fabs(mxAbs[2]) / project->convS;
+
+#     ifdef _MPI_
+      norm = project->subdom.Mpi_max( norm );
+#     endif
+
+      Forcing( project, norm );
+    }
+
     // determine relaxation parameter for NEWTON-RAPHSON ---------------------------------
 
     double maxUs;
@@ -968,6 +1192,22 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
   MEMORY::memo.Detach( X );
   MEMORY::memo.Detach( B );
 
+  delete precon;
+  jfnk = false;
+
+  if( contErr )
+  {
+    MEMORY::memo.Detach( contErr );
+    contErr   = NULL;
+    auxiliary = false;
+  }
+
+  if( localFac )
+  {
+    MEMORY::memo.Detach( localFac );
+    localFac = NULL;
+  }
+
 
   // experimental: force flow through outlet boundary > 0 --------------------------------
 
@@ -1089,44 +1329,19 @@ void EQS_UVS2D::Execute( PROJECT* project, int steadyFlow )
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-//void EQS_UVS2D::Predict( PROJECT* project, int init, double dt, double th )
-void EQS_UVS2D::Predict( PROJECT* project, int, double, double )
+void EQS_UVS2D::Predict( PROJECT* project, int steadyFlow, double dt, double th )
 {
   MODEL*  model = project->M2D;
   GRID*   rg    = model->region;
 
-//if( init )
-//{
-    for( int n=0; n<rg->Getnp(); n++ )
-    {
-      NODE *nd = rg->Getnode(n);
-
-      nd->v.dUdt = 0.0;
-      nd->v.dVdt = 0.0;
-      nd->v.dSdt = 0.0;
-    }
-//}
+  for( int n=0; n<rg->Getnp(); n++ )
+  {
+    NODE *nd = rg->Getnode(n);
 
-//else
-//{
-//  NODE** node = model->node;
-//  int    np   = model->np;
-//
-//  for( int i=0; i<np; i++ )
-//  {
-//    VARS*  v    = &(node[i]->v);
-//    VARS*  vo   = &(node[i]->vo);
-//    double thdt = 1.0 / dt / th;
-//
-//    v->U = vo->U  +  vo->dUdt * dt;
-//    v->V = vo->V  +  vo->dVdt * dt;
-//    v->S = vo->S  +  vo->dSdt * dt;
-//
-//    v->dUdt = (1.0 - 1.0/th)*vo->dUdt + thdt*(v->U - vo->U);
-//    v->dVdt = (1.0 - 1.0/th)*vo->dVdt + thdt*(v->V - vo->V);
-//    v->dSdt = (1.0 - 1.0/th)*vo->dSdt + thdt*(v->S - vo->S);
-//  }
-//}
+    nd->v.dUdt = 0.0;
+    nd->v.dVdt = 0.0;
+    nd->v.dSdt = 0.0;
+  }
 
   // ---------------------------------------------------------------------------------------------
   // initialize U,V,S and time gradients on previously dry nodes to their current values
@@ -1167,9 +1382,349 @@ void EQS_UVS2D::Predict( PROJECT* project, int, double, double )
     //   nd->vo.dSdt = 0.0;                 //    Wasserspiegels an?
     // }                                    //    Vielleicht: vo.S = v.S - dryLimit ???
   }                                         // Wuerde es Sinn machen, die Aenderung der Sohlhoehe
-}                                           // zwischen zwei Zeitschritten zu protokollieren und
+                                            // zwischen zwei Zeitschritten zu protokollieren und
                                             // im Zeitgradienten dHdt=dSdt-dZdt zu beruecksichtigen?
 
+  if( project->predictor > 0 )  Extrapolate( project, steadyFlow, dt, th );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Extrapolate U,V,S at wet nodes from the time levels n, n-1 and n-2 to the new time level n+1
+// as initial state of the Newton iteration. The Lagrange polynomial through the levels is of
+// order project->predictor (1 = linear, 2 = quadratic) and is reduced where fewer levels are
+// available, e.g. after the node has been dry. Nodes which would fall dry are not predicted.
+// Level n is vo; it is kept in histUVS together with n-1 and n-2 and becomes level n-1, when
+// the next time level is predicted. A sub step, which is repeated with a reduced time
+// increment (PROJECT::AdaptReject), is predicted again from the same levels.
+
+void EQS_UVS2D::Extrapolate( PROJECT* project, int steadyFlow, double dt, double th )
+{
+  MODEL*  model = project->M2D;
+  GRID*   rg    = model->region;
+  int     np    = rg->Getnp();
+
+  double  time  = project->timeint.actualTime.Getsec();
+
+  int     init  = ( histNp != np );
+
+  if( init )
+  {
+    delete[] histUVS;
+    delete[] histCnt;
+
+    histUVS = new double[9*np];
+    histCnt = new char[np];
+
+    if( !histUVS || !histCnt )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS_UVS2D::Extrapolate(1)" );
+
+    histNp = np;
+    memset( histCnt, 0, np*sizeof(char) );
+
+    predTime    = time;
+    predDt      = 0.0;
+    histTime[0] = histTime[1] = time;
+  }
+
+  // no prediction in stationary computations; restart the history ---------------------
+  if( steadyFlow )
+  {
+    memset( histCnt, 0, np*sizeof(char) );
+    predTime    = time;
+    predDt      = 0.0;
+    histTime[0] = histTime[1] = time;
+    return;
+  }
+
+  // repeated call for the same time level: a further flow cycle of the sub step is not
+  // predicted; a sub step with another time increment is predicted again
+  int repeat = !init  &&  time <= predTime;
+
+  if( repeat  &&  dt == predDt )  return;
+
+  if( repeat )
+  {
+    // level n will be kept once more
+    for( int n=0; n<np; n++ )  if( histCnt[n] > 0 )  histCnt[n]--;
+  }
+
+  else
+  {
+    // shift the time levels: n -> n-1 -> n-2 ------------------------------------------
+    for( int n=0; n<np; n++ )
+    {
+      double* hist = histUVS + 9*n;
+
+      for( int k=8; k>=3; k-- )  hist[k] = hist[k-3];
+
+      if( histCnt[n] > 2 )  histCnt[n] = 2;
+    }
+
+    histTime[1] = histTime[0];
+    histTime[0] = predTime;
+  }
+
+  predTime = time;
+  predDt   = dt;
+
+  double h1 = time - histTime[0];           // length of time step n-1 -> n
+  double h2 = histTime[0] - histTime[1];    // length of time step n-2 -> n-1
+
+  // weights of the Lagrange polynomials for levels n, n-1 and n-2 -----------------------
+  double w1[2] = { 0.0, 0.0 };
+  double w2[3] = { 0.0, 0.0, 0.0 };
+
+  if( h1 > 0.0 )
+  {
+    w1[0] =  1.0 + dt / h1;
+    w1[1] = -dt / h1;
+  }
+
+  if( h1 > 0.0  &&  h2 > 0.0 )
+  {
+    w2[0] =  (dt + h1) * (dt + h1 + h2) / h1 / (h1 + h2);
+    w2[1] = -dt * (dt + h1 + h2) / h1 / h2;
+    w2[2] =  dt * (dt + h1) / h2 / (h1 + h2);
+  }
+
+  double dryLimit = rg->dryRew.dryLimit;
+  double iTheta   = 1.0  -  1.0 / th;
+  double thdt     = 1.0 / dt  / th;
+
+  int    npred    = 0;
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE*   nd   = rg->Getnode(n);
+    VARS*   v    = &nd->v;
+    VARS*   vo   = &nd->vo;
+    double* hist = histUVS + 9*n;
+
+    if(     isFS(nd->flag, NODE::kDry)
+        ||  isFS(nd->flag, NODE::kDryPrev)
+        ||  isFS(nd->flag, NODE::kMarsh)
+        ||  isFS(nd->flag, NODE::kMarshPrev) )
+    {
+      histCnt[n] = 0;
+      continue;
+    }
+
+    int order = histCnt[n];
+    if( order > project->predictor )  order = project->predictor;
+    if( order > 1  &&  h2 <= 0.0 )    order = 1;
+    if( h1 <= 0.0 )                   order = 0;
+
+    double U = vo->U;
+    double V = vo->V;
+    double S = vo->S;
+
+    if( order == 1 )
+    {
+      U = w1[0]*vo->U + w1[1]*hist[3];
+      V = w1[0]*vo->V + w1[1]*hist[4];
+      S = w1[0]*vo->S + w1[1]*hist[5];
+    }
+
+    else if( order == 2 )
+    {
+      U = w2[0]*vo->U + w2[1]*hist[3] + w2[2]*hist[6];
+      V = w2[0]*vo->V + w2[1]*hist[4] + w2[2]*hist[7];
+      S = w2[0]*vo->S + w2[1]*hist[5] + w2[2]*hist[8];
+    }
+
+    if( order > 0  &&  S - nd->zor > dryLimit )
+    {
+      v->U = U;
+      v->V = V;
+      v->S = S;
+
+      v->dUdt = iTheta*vo->dUdt + thdt*(U - vo->U);
+      v->dVdt = iTheta*vo->dVdt + thdt*(V - vo->V);
+      v->dSdt = iTheta*vo->dSdt + thdt*(S - vo->S);
+
+      npred++;
+    }
+
+    // keep level n ----------------------------------------------------------------------
+    hist[0] = vo->U;
+    hist[1] = vo->V;
+    hist[2] = vo->S;
+
+    histCnt[n]++;
+  }
+
+  REPORT::rpt.Message( 3, "\n%-25s%s %d\n", " (EQS_UVS2D::Predict)",
+                          "number of predicted nodes:", npred );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Jacobian-free product r = A * x: the force vector B is evaluated at the state perturbed
+// by eps*x, r = (B(u) - B(u + eps*x)) / eps, and scaled like the right hand side. Time
+// gradients are perturbed with relaxThdt, which corresponds to the time terms of the
+// Newton matrix; local pseudo time steps (localFac) apply to the preconditioner only.
+
+void EQS_UVS2D::MulVecFD( double* x, double* r, PROJECT* project )
+{
+  MODEL* model = project->M2D;
+  GRID*  rg    = model->region;
+
+  int np     = rg->Getnp();
+  int neq_dn = crsm->m_neq_dn;
+
+
+  // size of the perturbation: eps * ||x|| = kDelta * (average |u| + 1) ------------------
+
+  const double kDelta = 1.0e-7;
+
+  double xx = 0.0;
+  double uu = 0.0;
+  double nu = 0.0;
+
+  for( int i=0; i<neq_dn; i++ )  xx += x[i] * x[i];
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+
+    int eqnoU = GetEqno( nd, 0 );
+    int eqnoV = GetEqno( nd, 1 );
+    int eqnoS = GetEqno( nd, 2 );
+
+    if( eqnoU >= 0  &&  eqnoU < neq_dn )  { uu += fabs( nd->v.U );  nu++; }
+    if( eqnoV >= 0  &&  eqnoV < neq_dn )  { uu += fabs( nd->v.V );  nu++; }
+    if( eqnoS >= 0  &&  eqnoS < neq_dn )  { uu += fabs( nd->v.S );  nu++; }
+  }
+
+# ifdef _MPI_
+  xx = project->subdom.Mpi_sum( xx );
+  uu = project->subdom.Mpi_sum( uu );
+  nu = project->subdom.Mpi_sum( nu );
+# endif
+
+  if( xx <= 0.0 )
+  {
+    for( int i=0; i<neq; i++ )  r[i] = 0.0;
+    return;
+  }
+
+  if( nu > 0.0 )  uu /= nu;
+
+  double eps = kDelta * (uu + 1.0) / sqrt( xx );
+
+
+  // perturb the state of nodes (corrections in rotated coordinates, see Execute) -------
+
+  double* U    = (double*) MEMORY::memo.Array_nd( np );
+  double* V    = (double*) MEMORY::memo.Array_nd( np );
+  double* S    = (double*) MEMORY::memo.Array_nd( np );
+  double* dUdt = (double*) MEMORY::memo.Array_nd( np );
+  double* dVdt = (double*) MEMORY::memo.Array_nd( np );
+  double* dSdt = (double*) MEMORY::memo.Array_nd( np );
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+
+    U[n]    = nd->v.U;
+    V[n]    = nd->v.V;
+    S[n]    = nd->v.S;
+    dUdt[n] = nd->v.dUdt;
+    dVdt[n] = nd->v.dVdt;
+    dSdt[n] = nd->v.dSdt;
+
+    double dU = 0.0;
+    double dV = 0.0;
+    double dS = 0.0;
+
+    int eqnoU = GetEqno( nd, 0 );
+    int eqnoV = GetEqno( nd, 1 );
+    int eqnoS = GetEqno( nd, 2 );
+
+    if( eqnoU >= 0 )  dU = eps * x[eqnoU];
+    if( eqnoV >= 0 )  dV = eps * x[eqnoV];
+    if( eqnoS >= 0 )  dS = eps * x[eqnoS];
+
+    if( isFS(nd->flag, NODE::kRotat) )
+    {
+      double dx = nd->bc.Getrot(0,0) * dU  +  nd->bc.Getrot(0,1) * dV;
+      double dy = nd->bc.Getrot(1,0) * dU  +  nd->bc.Getrot(1,1) * dV;
+
+      dU = dx;
+      dV = dy;
+    }
+
+    nd->v.U    += dU;
+    nd->v.V    += dV;
+    nd->v.S    += dS;
+    nd->v.dUdt += relaxThdt_UV * dU;
+    nd->v.dVdt += relaxThdt_UV * dV;
+    nd->v.dSdt += relaxThdt_H  * dS;
+  }
+
+
+  // residual of the perturbed state and difference quotient -----------------------------
+
+  crsm->AssembleForce( this, r, model, project );
+
+  double fac = 1.0 / eps / jfnkScale;
+
+  for( int i=0; i<neq; i++ )  r[i] = fac * (jfnkForce[i] - r[i]);
+
+  for( int i=0; i<nmask; i++ )  r[mask[i]] = x[mask[i]];
+
+
+  // reset the state of nodes ------------------------------------------------------------
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+
+    nd->v.U    = U[n];
+    nd->v.V    = V[n];
+    nd->v.S    = S[n];
+    nd->v.dUdt = dUdt[n];
+    nd->v.dVdt = dVdt[n];
+    nd->v.dSdt = dSdt[n];
+  }
+
+  MEMORY::memo.Detach( U );
+  MEMORY::memo.Detach( V );
+  MEMORY::memo.Detach( S );
+  MEMORY::memo.Detach( dUdt );
+  MEMORY::memo.Detach( dVdt );
+  MEMORY::memo.Detach( dSdt );
+
+  ////////////////////////////////////////////////////////////////////////////////////////
+  // assemble local vector r from all adjacent subdomains
+# ifdef _MPI_
+  Mpi_assemble( r, project );
+# endif
+  ////////////////////////////////////////////////////////////////////////////////////////
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Continuity error of a region element [m/s]: the force vector of the continuity equation
+// at corner nodes sums up to the negative integral of the residual over the element, since
+// the linear shape functions sum up to one.
+
+void EQS_UVS2D::Auxiliary( ELEM* elem, PROJECT* project, double* force )
+{
+  if( !contErr  ||  !isFS(elem->flag, ELEM::kRegion) )  return;
+
+  int nnd = elem->Getnnd();
+  int ncn = elem->Getncn();
+
+  double f = 0.0;
+
+  for( int j=0; j<ncn; j++ )  f -= force[2*nnd + j];
+
+  double A = fabs( elem->area() );
+
+  if( A > 0.0 )  contErr[elem->Getno()] = f / A;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 void EQS_UVS2D::Timegrad( PROJECT* project, double dt, double th )
@@ -12,6 +12,10 @@
 // CoefsUVS2D.cpp : methods EQS_UVS2D::Coefs()
 //                          EQS_UVS2D::Bound()
 //                          EQS_UVS2D::Region()
+//                          EQS_UVS2D::Inflow()
+//                          EQS_UVS2D::Batched()
+//                          EQS_UVS2D::CoefsBatch()
+//                          EQS_UVS2D::RegionBatch()
 //                          EQS_UVS2D::Bound_pinc()
 //                          EQS_UVS2D::Region_pinc()
 //
@@ -69,6 +73,17 @@
 //                            dfyx  =  0.0;   (should be dfxy = 0.0;)
 //                            ...
 //  18.08.2012    sc     The anisotrop method EQS_UVS2D::RegionAI is now implemented
+//  19.10.2026    ag     Region() dispatches to kernels specialised for 6-node triangles
+//                       and 8-node quadrilaterals (template Region<nnd,ncn>)
+//  19.10.2026    ag     coefficients of region elements in batches of EQS::kBatch
+//                       elements: Batched(), CoefsBatch(), RegionBatch()
+//  19.10.2026    ag     Predict() extrapolates U,V,S from previous time levels (linear
+//                       or quadratic); history of time levels in histUVS/histCnt
+//  19.10.2026    ag     local pseudo time steps in time relaxed stationary computations
+//  19.10.2026    ag     adaptive tolerance of the iterative solver (EQS::Forcing)
+//  19.10.2026    ag     Jacobian-free Newton-Krylov iterations: MulVecFD()
+//  19.10.2026    ag     continuity errors of elements from the element pass: Auxiliary()
+//                       (optional, key $CONTERR)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -92,6 +107,18 @@ class EQS_UVS2D : public EQS
     double  relaxThdt_UV;
     double  relaxThdt_H;
 
+    int     batchCoefs;          // compute region elements in batches (CoefsBatch)
+
+    // time levels for the predictor
+    int     histNp;              // number of nodes in history
+    double  predTime;            // time of level n and time increment of the last prediction
+    double  predDt;
+    double  histTime[2];         // time of levels n-1 and n-2
+    double* histUVS;             // U,V,S at levels n, n-1 and n-2 (9 values per node)
+    char*   histCnt;             // number of kept levels per node (0 ... 3), counted from n
+
+    double* contErr;             // continuity errors of region elements (Auxiliary)
+
     // dispersion terms
     double *Duu;
     double *Dvv;
@@ -105,11 +132,27 @@ class EQS_UVS2D : public EQS
     virtual void Predict( PROJECT*, int, double, double );
     virtual void Timegrad( PROJECT*, double, double );
 
+    virtual void MulVecFD( double*, double*, PROJECT* );
+    virtual void Auxiliary( ELEM*, PROJECT*, double* );
+
   protected:
+    void Extrapolate( PROJECT*, int, double, double );
+
     virtual int  Coefs( ELEM*, PROJECT*, double**, double* );
     virtual void Bound( ELEM*, PROJECT*, double**, double* );
     virtual void Region( ELEM*, PROJECT*, double**, double* );
 
+    template< int kNnd, int kNcn >
+    void Region( ELEM*, PROJECT*, double**, double* );
+
+    void Inflow( ELEM*, PROJECT*, double, double**, double* );
+
+    virtual int  Batched( ELEM* );
+    virtual void CoefsBatch( int, ELEM**, PROJECT*, double***, double** );
+
+    template< int kNnd, int kNcn >
+    void RegionBatch( int, ELEM**, PROJECT*, double***, double** );
+
     virtual void Bound_pinc( ELEM*, PROJECT*, double**, double* );
     virtual void Region_pinc( ELEM*, PROJECT*, double**, double* );
 };
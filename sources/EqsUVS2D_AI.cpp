@@ -39,6 +39,8 @@
 EQS_UVS2D_AI::EQS_UVS2D_AI() : EQS_UVS2D()
 {
   neq = 0;
+
+  batchCoefs = false;   // coefficients are computed by EQS_UVS2D_AI::Coefs()
 }
 
 
@@ -299,6 +299,9 @@ void EQS_UVS2D_LV::Execute( PROJECT* project, int steadyFlow )
 
   double Qout = -1.0;
 
+  int    bconInit = -1;
+  double bconTime = 0.0;
+
   int cycleIter = 0;
 
   int conv = true;
@@ -328,13 +331,29 @@ void EQS_UVS2D_LV::Execute( PROJECT* project, int steadyFlow )
 
     // set inflow and outflow condition --------------------------------------------------
 
+    // boundary setup is repeated only for a new time level, after drying and rewetting
+    // or if the setup depends on the flow state (see EQS_UVS2D::Execute())
+    BCONSET* abcs = project->timeint.actualBcSet;
+
     TIME bcTime = project->timeint.actualTime + project->timeint.incTime;
 
-    project->timeint.actualBcSet->InitBcon( project, &bcTime, &Qout );
+    if(     model->Getinit() != bconInit  ||  bcTime.Getsec() != bconTime
+        ||  abcs->stateDep )
+    {
+      bconInit = model->Getinit();
+      bconTime = bcTime.Getsec();
 
-    model->SetLocation();
-    model->SetNormal();
-    model->SetRotation();
+      abcs->InitBcon( project, &bcTime, &Qout );
+
+      model->SetLocation();
+      model->SetNormal();
+      model->SetRotation();
+    }
+
+    else
+    {
+      abcs->UpdateBcon( project );
+    }
 
 
     // output current time intervals -----------------------------------------------------
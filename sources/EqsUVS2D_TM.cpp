@@ -51,6 +51,8 @@ EQS_UVS2D_TM::EQS_UVS2D_TM() : EQS_UVS2D()
 {
   neq      = 0;
   timegrad = 0;
+
+  batchCoefs = false;   // coefficients are computed by EQS_UVS2D_TM::Coefs()
 }
 
 
@@ -54,7 +54,8 @@ double TYPE::bottom( double  Us,        // scalar velocity
                      double  rho,       // density of water
                      double  rhob,      // density of sediment
                      double  d50,       // 50% diameter of grain
-                     double  d90 )      // 90% diameter of grain
+                     double  d90,       // 90% diameter of grain
+                     double* cw )       // start value / solution of 1/sqrt(cf)
 {
   // ------------------------------------------------------------------------------------
   // compute form roughness, test for presence of vegetation
@@ -80,26 +81,15 @@ double TYPE::bottom( double  Us,        // scalar velocity
 
   // ------------------------------------------------------------------------------------
   // compute friction coefficient for bottom roughness
-  double cb = 0.0;
-
-  // Colebrook-Whites or Nikuradses law chosen for grain roughness ...
-  if( rtype < kCHEZ  &&  kslaw > 0 )
-  {
-    cb = friction( rtype, ksfact*d90 + kd + kr, Us, H, ka, vk, g );
-  }
-
-  // ... Chezys or Mannings law chosen for grain roughness
-  else
-  {
-    cb  = friction( rtype, rcoef, Us, H, ka, vk, g );
-    cb += friction( kNIKU, kd + kr, Us, H, ka, vk, g );
-  }
+  double cb = grain( Us, H, ka, vk, g, d90, kd, kr, cw );
 
   _cb = cb;          // remind cb in static class variable _cb
 
   // ------------------------------------------------------------------------------------
   // compute friction coefficient for non-submerged vegetation
-  double cp = lindner( dp[0], sp[0], Us, H, cb, vk, g );
+  if( dp[0] >= 1.0e-4  &&  sp[0] >= 1.0e-4 )  dragBuild( ka, vk, g, d90 );
+
+  double cp = vegetation( Us, H, cb, vk, g );
 
   if( cp < -0.9 )    // means: cp == -1.0
   {
@@ -119,6 +109,90 @@ double TYPE::bottom( double  Us,        // scalar velocity
 }
 
 
+// --------------------------------------------------------------------------------------
+// Methode TYPE::bottom() for a batch of n <= kBatch nodes
+// --------------------------------------------------------------------------------------
+// Without non-submerged vegetation the scalar method is called for each node. Otherwise
+// there is no form roughness and the drag coefficients of the batch are interpolated in
+// one pass from the table TYPE::drag, if the table is enabled ($DRAGTABLE).
+
+void TYPE::bottom( int     n,         // number of nodes
+                   double* Us,        // scalar velocities
+                   double* H,         // flow depths
+                   double  ka,        // von Karman's constant ( = 0.41 )
+                   double  vk,        // kinematic viscosity
+                   double  g,         // gravity acceleration ( = 9.81 )
+                   double  rho,       // density of water
+                   double  rhob,      // density of sediment
+                   double  d50,       // 50% diameter of grain
+                   double  d90,       // 90% diameter of grain
+                   double* cw,        // start values / solutions of 1/sqrt(cf)
+                   double* cf )       // friction coefficients on return
+{
+  if( dp[0] < 1.0e-4  ||  sp[0] < 1.0e-4 )
+  {
+    for( int i=0; i<n; i++ )
+    {
+      cf[i] = bottom( Us[i], H[i], ka, vk, g, rho, rhob, d50, d90, &cw[i] );
+    }
+
+    return;
+  }
+
+  double cb[kBatch];
+  double cp[kBatch];
+
+  dragBuild( ka, vk, g, d90 );
+
+  for( int i=0; i<n; i++ )  cb[i] = grain( Us[i], H[i], ka, vk, g, d90, 0.0, 0.0, &cw[i] );
+
+  vegetation( n, Us, H, cb, cp, vk, g );
+
+  for( int i=0; i<n; i++ )
+  {
+    if( cp[i] < -0.9 )  cp[i] = cb[i]  +  0.75 * H[i] * dp[0] / sp[0] / sp[0];
+
+    cf[i] = cp[i] + velzen( hp, dp[1], sp[1], Us[i], H[i], cb[i], ka, vk, g );
+  }
+
+  _cb = cb[n-1];
+  _cp = cp[n-1];
+}
+
+
+// --------------------------------------------------------------------------------------
+// Methode TYPE::grain()
+// --------------------------------------------------------------------------------------
+
+double TYPE::grain( double  Us,        // scalar velocity
+                    double  H,         // flow depth
+                    double  ka,        // von Karman's constant ( = 0.41 )
+                    double  vk,        // kinematic viscosity
+                    double  g,         // gravity acceleration ( = 9.81 )
+                    double  d90,       // 90% diameter of grain
+                    double  kd,        // form roughness of dunes
+                    double  kr,        // form roughness of ripples
+                    double* cw )       // start value / solution of 1/sqrt(cf)
+{
+  double cb = 0.0;
+
+  // Colebrook-Whites or Nikuradses law chosen for grain roughness ...
+  if( rtype < kCHEZ  &&  kslaw > 0 )
+  {
+    cb = friction( rtype, ksfact*d90 + kd + kr, Us, H, ka, vk, g, cw );
+  }
+
+  // ... Chezys or Mannings law chosen for grain roughness
+  else
+  {
+    cb  = friction( rtype, rcoef, Us, H, ka, vk, g, cw );
+    cb += friction( kNIKU, kd + kr, Us, H, ka, vk, g );
+  }
+
+  return cb;
+}
+
+
 // --------------------------------------------------------------------------------------
 // Methode TYPE::friction()
 // --------------------------------------------------------------------------------------
@@ -129,7 +203,8 @@ double TYPE::friction( int    rtype,        // roughness type
                        double h,            // flow depth
                        double ka,           // von Karman's constant ( = 0.41 )
                        double vk,           // kinematic viscosity
-                       double g )           // gravity acceleration ( = 9.81 )
+                       double g,            // gravity acceleration ( = 9.81 )
+                       double* cw )         // start value / solution of 1/sqrt(cf)
 {
   int    iter;
   double term;
@@ -165,6 +240,28 @@ double TYPE::friction( int    rtype,        // roughness type
 
           cf = 2.5;                            // initialize cf=1/sqrt(cf) for iteration
 
+          // warm start with the solution of a previous call (e.g. at the same node)
+          if( cw  &&  *cw > 0.0 )  cf = *cw;
+
+#         ifdef _COWI_NEWTON
+          // NEWTON iteration for F(x) = x + 2.03*log10(x*term1 + term2) = 0 with
+          // x = 1/sqrt(cf); converges in few steps to the same relative precision
+          double c = 2.03 / log(10.0);
+
+          do
+          {
+            double arg = cf*term1 + term2;
+            double F   = cf  +  2.03 * log10( arg );
+            double dF  = 1.0  +  c * term1 / arg;
+
+            oldCf = cf;
+            cf    = oldCf - F / dF;
+            iter++;
+
+            if( cf <= 0.0 )  { iter = 50;  break; }
+
+          } while( fabs((cf-oldCf)/cf) > 1.0e-6  &&  iter < 50 );
+#         else
           do
           {
             oldCf = cf;
@@ -172,6 +269,7 @@ double TYPE::friction( int    rtype,        // roughness type
             iter++;
 
           } while( fabs((cf-oldCf)/cf) > 1.0e-6  &&  iter < 50 );
+#         endif
 
           if( iter >= 50 )
           {
@@ -179,6 +277,10 @@ double TYPE::friction( int    rtype,        // roughness type
             //REPORT::rpt.Warning( kValueFault, "%s (TYPE::friction #2)",
             //                     "Colebrook-White's roghness law did not converge" );
           }
+          else if( cw )
+          {
+            *cw = cf;
+          }
 
           cf = 1.0 / cf / cf / 8.0;
         }
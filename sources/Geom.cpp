@@ -0,0 +1,225 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class GEOM
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Defs.h"
+#include "Report.h"
+#include "Shape.h"
+#include "Node.h"
+#include "Elem.h"
+#include "Grid.h"
+
+#include "Geom.h"
+
+
+GEOM::GEOM()
+{
+  ne     = 0;
+  elem   = NULL;
+  offset = NULL;
+  valid  = NULL;
+  data   = NULL;
+  base   = NULL;
+}
+
+
+GEOM::~GEOM()
+{
+  Free();
+}
+
+
+void GEOM::Free()
+{
+  if( offset )  delete[] offset;
+  if( valid )   delete[] valid;
+  if( base )    delete[] base;
+
+  ne     = 0;
+  elem   = NULL;
+  offset = NULL;
+  valid  = NULL;
+  data   = NULL;
+  base   = NULL;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// set up the offsets of element blocks; every block starts on a cache line
+
+void GEOM::Init( int ne, ELEM* elem )
+{
+  Free();
+
+  if( ne <= 0 )  return;
+
+  offset = new long [ne];
+  valid  = new char [ne];
+
+  if( !offset || !valid )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - GEOM::Init(1)" );
+
+  long size = 0;
+
+  for( int e=0; e<ne; e++ )
+  {
+    SHAPE* lShape = elem[e].GetLShape();
+    SHAPE* qShape = elem[e].GetQShape();
+
+    offset[e] = size;
+    valid[e]  = false;
+
+    size += qShape->ngp * Size( qShape->nnd, lShape->nnd );
+    size  = ((size + 7) / 8) * 8;
+  }
+
+  base = new double [size + 8];
+
+  if( !base )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - GEOM::Init(2)" );
+
+  data = (double*) (((size_t) base + 63) & ~((size_t) 63));
+
+  this->ne   = ne;
+  this->elem = elem;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// return the block of an element; elements which are not part of the grid (e.g. virtual
+// elements set up in coefficient routines) are computed into the block local[kMaxGeom]
+// of the caller
+
+double* GEOM::Get( ELEM* elem, double* local )
+{
+  int e = elem->Getno();
+
+  if( e < 0  ||  e >= ne  ||  elem != &this->elem[e] )
+  {
+    Compute( elem, local );
+    return local;
+  }
+
+  double* block = data + offset[e];
+
+  if( !valid[e] )
+  {
+    Compute( elem, block );
+    valid[e] = true;
+  }
+
+  return block;
+}
+
+
+void GEOM::Invalidate()
+{
+  for( int e=0; e<ne; e++ )  valid[e] = false;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// compute the Jacobian with quadratic shape functions and the global derivatives of
+// quadratic and linear shape functions at all Gauss points
+
+void GEOM::Compute( ELEM* elem, double* block )
+{
+  SHAPE* lShape = elem->GetLShape();
+  SHAPE* qShape = elem->GetQShape();
+
+  int ngp = qShape->ngp;
+  int nnd = qShape->nnd;
+  int ncn = lShape->nnd;
+
+
+  // compute coordinates relative to first node ------------------------------------------
+
+  double x[kMaxND], y[kMaxND];
+
+  x[0] = elem->nd[0]->x;
+  y[0] = elem->nd[0]->y;
+
+  for( int i=1; i<nnd; i++ )
+  {
+    x[i] = elem->nd[i]->x - x[0];
+    y[i] = elem->nd[i]->y - y[0];
+  }
+
+  x[0] = y[0] = 0.0;
+
+
+  for( int g=0; g<ngp; g++ )
+  {
+    double* dfdxPtr = qShape->dfdx[g];
+    double* dfdyPtr = qShape->dfdy[g];
+
+    double trafo[2][2];
+
+    double detj = qShape->jacobi2D( nnd, dfdxPtr, dfdyPtr, x, y, trafo );
+
+    double* dndx = block + 1;
+    double* dndy = dndx  + nnd;
+    double* dmdx = dndy  + nnd;
+    double* dmdy = dmdx  + ncn;
+
+    block[0] = detj * qShape->weight[g];
+
+    for( int j=0; j<nnd; j++ )
+    {
+      dndx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
+      dndy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
+    }
+
+    dfdxPtr = lShape->dfdx[g];
+    dfdyPtr = lShape->dfdy[g];
+
+    for( int j=0; j<ncn; j++ )
+    {
+      dmdx[j] = trafo[0][0] * dfdxPtr[j]  +  trafo[0][1] * dfdyPtr[j];
+      dmdy[j] = trafo[1][0] * dfdxPtr[j]  +  trafo[1][1] * dfdyPtr[j];
+    }
+
+    block += Size( nnd, ncn );
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// return the cached geometry of an element of this grid; local[kMaxGeom] is used for
+// elements, which are not part of the grid
+
+double* GRID::Geometry( ELEM* el, double* local )
+{
+  if( geom.ne != ne  ||  geom.elem != elem )  geom.Init( ne, elem );
+
+  return geom.Get( el, local );
+}
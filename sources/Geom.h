@@ -0,0 +1,110 @@
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// G E O M
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// FILES
+//
+// Geom.h   : definition file of the class.
+// Geom.cpp : implementation file of the class.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// DESCRIPTION
+//
+// This class implements a cache of the element geometry at Gauss points. For each element of a
+// grid and each Gauss point of its quadratic shape the following values are stored in a
+// contiguous block:
+//
+//   weight          : determinant of the Jacobian (quadratic shape) times Gauss weight
+//   dndx[nnd]       : global derivatives of the quadratic shape functions
+//   dndy[nnd]
+//   dmdx[ncn]       : global derivatives of the linear shape functions
+//   dmdy[ncn]
+//
+// The geometry depends on the horizontal coordinates of nodes only. Blocks are computed on
+// first use; the cache is dropped with the element array of the grid and invalidated, when the
+// coordinates are changed (scaling in PROJECT::Compute). Elements, which are not part of the
+// grid, are computed into a block provided by the caller.
+//
+// -------------------------------------------------------------------------------------------------
+//
+// COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
+//
+// This program is free software; you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation; either version 2 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program; if
+// not, write to the
+//
+// Free Software Foundation, Inc.
+// 59 Temple Place
+// Suite 330
+// Boston
+// MA 02111-1307 USA
+//
+// -------------------------------------------------------------------------------------------------
+//
+// P.M. Schroeder
+// Walzbachtal / Germany
+// michael.schroeder@hnware.de
+//
+// -------------------------------------------------------------------------------------------------
+//
+// HISTORY
+//
+//    date              changes
+// ------------  ----  -----------------------------------------------------------------------------
+//  19.10.2026    ag    first implementation: cache of element geometry for GRID::geom
+//  19.10.2026    ag    block for elements not in the grid provided by the caller
+//
+// /////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GEOM_INCL
+#define GEOM_INCL
+
+#include "Defs.h"
+#include "Shape.h"
+
+#define kMaxGeom  (kMaxGP2D * (1 + 4*kMaxND))     // maximum size of an element block
+
+class ELEM;
+
+
+class GEOM
+{
+  friend class GRID;
+
+  private:
+    int     ne;                 // number of elements
+    ELEM*   elem;               // elements of the grid
+
+    long*   offset;             // offset of element blocks in data[]
+    char*   valid;              // flag: block of element is valid
+    double* data;               // cached values (aligned to cache lines)
+    double* base;               // allocated memory for data[]
+
+  public:
+    GEOM();
+    ~GEOM();
+
+    void    Init( int ne, ELEM* elem );
+    void    Free();
+
+    double* Get( ELEM* elem, double* local );
+    void    Invalidate();
+
+    // number of values per Gauss point
+    static int Size( int nnd, int ncn )  { return 1 + 2*nnd + 2*ncn; };
+
+  private:
+    void    Compute( ELEM* elem, double* block );
+};
+
+#endif
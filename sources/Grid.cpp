@@ -76,6 +76,9 @@ void GRID::KillElem()
 {
   delete[] elem;
   ne = 0;
+
+  geom.Free();
+  dryFront.Free();
 }
 
 
@@ -97,6 +100,9 @@ void GRID::Setelem( int ne, ELEM* elem )
 {
   this->ne   = ne;
   this->elem = elem;
+
+  geom.Free();
+  dryFront.Free();
 }
 
 
@@ -121,6 +127,9 @@ void GRID::Alloc( int np, int ne )
 
     for( int i=0; i<this->ne; i++ )  elem[i].Setno(i);
   }
+
+  geom.Free();
+  dryFront.Free();
 }
 
 
@@ -131,6 +140,9 @@ void GRID::Free()
 
   if( ne )  delete[] elem;
   ne = 0;
+
+  geom.Free();
+  dryFront.Free();
 }
 
 
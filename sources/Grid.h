@@ -13,13 +13,16 @@
 // Arfact.cpp     : method  GRID::AreaFactors()
 // Check.cpp      : method  GRID::Check()
 // Connect.cpp    : method  GRID::Connection()
-// Courant.cpp    : method  GRID::ReportCuPe()
+// Courant.cpp    : methods GRID::ReportCuPe()
+//                          GRID::MaxCuPe()
+//                          GRID::LocalTime()
 // Dispersion.cpp : method  GRID::Dispersion()
 // DryRewet.cpp   : methods GRID::Dry()
 //                          GRID::Rewet()
 //                          GRID::ReportDry()
 //                          GRID::DryRewet()
 //                          GRID::RewetDry()
+//                          GRID::SetFront()
 // EddyDisp.cpp   : method  GRID::EddyDisp()
 // Init.cpp       : method  GRID::InitKD()
 // InitS.cpp      : method  GRID::InitS()
@@ -30,7 +33,8 @@
 // Turbulence.cpp : method  GRID::Turbulence()
 // VeloGrad.cpp   : method  GRID::VeloGrad()
 //
-// Interpol.cpp   : method  DRYREW::interpolate()
+// Interpol.cpp   : methods DRYREW::interpolate()
+//                          DRYREW::Connect()
 //
 // -------------------------------------------------------------------------------------------------
 //
@@ -74,6 +78,14 @@
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1992    sc    first implementation / first concept
 //  16.02.2013    sc    rewetting of nodes in DryRewet() and RewetDry() adapted
+//  19.10.2026    ag    cache of element geometry at Gauss points GRID::geom
+//  19.10.2026    ag    change detection of node state for friction and eddy viscosity
+//  19.10.2026    ag    spatial index of nodes and elements GRID::bucket
+//  19.10.2026    ag    k-ring gather over node adjacency in DRYREW::interpolate()
+//  19.10.2026    ag    front tracking dry/rewet: GRID::DryRewet() on node and element lists
+//  19.10.2026    ag    element factors for local pseudo time steps GRID::LocalTime()
+//  19.10.2026    ag    GRID::SmoothKD() restricted to marked nodes
+//  19.10.2026    ag    DRYREW::stableEqno: equation numbers kept over drying and rewetting
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,6 +93,9 @@
 #define GRID_INCL
 
 #include "Defs.h"
+#include "Changes.h"
+#include "Geom.h"
+#include "Bucket.h"
 
 class ELEM;
 class NODE;
@@ -102,6 +117,24 @@ class DRYREW
     int    countDown;          // countDown for elements to be rewetted
     double rewetLimit;         // limit for flow depth to rewet nodes
     double dryLimit;           // limit for flow depth to eliminate nodes
+    int    frontFreq;          // frequency of dry/rewet on the wet/dry line only (method 2)
+    int    stableEqno;         // keep equation numbers and index matrix over dry/rewet
+
+  private:
+    GRID*   adjGrid;           // grid of the node-to-node adjacency
+    int     adjValid;          // adjacency is up to date with the element connectivity
+    int     nAdjNode;          // size of node arrays
+    int     nAdjBuf;           // size of adjNode[] and adjWgt[]
+    int*    adjStart;          // corner nodes adjacent to node i in region elements:
+    int*    adjNode;           //   adjNode[adjStart[i]] ... adjNode[adjStart[i+1]-1]
+    double* adjWgt;            // inverse distance times number of shared elements
+
+    int     curStamp;          // scratch of the k-ring gather in interpolate()
+    int*    stamp;
+    int*    ringPos;
+    int*    ring;
+    int     nRingVal;
+    double* ringVal;
 
   public:
     DRYREW()
@@ -112,9 +145,79 @@ class DRYREW
       rewetLimit   = 0.005;
       rewetPasses  = 100;
       countDown    = 5;
+      frontFreq    = 0;
+      stableEqno   = 0;
+
+      adjGrid      = NULL;
+      adjValid     = false;
+      nAdjNode     = 0;
+      nAdjBuf      = 0;
+      adjStart     = NULL;
+      adjNode      = NULL;
+      adjWgt       = NULL;
+
+      curStamp     = 0;
+      stamp        = NULL;
+      ringPos      = NULL;
+      ring         = NULL;
+      nRingVal     = 0;
+      ringVal      = NULL;
     };
 
+    ~DRYREW();
+
+    // the adjacency is taken from the element connectivity NODE::el; it has to be
+    // released with Disconnect(), whenever GRID::Connection() is called
+    void   Connect( GRID* );
+    void   Disconnect()        { adjValid = false; };
+
     double interpolate( NODE*, int, int );
+    void   interpolate( NODE*, int depth, int nvar, const int* var, double* val );
+};
+
+
+// nodes and elements near the wet/dry line for the front tracking dry/rewet -----------------------
+
+class DRYFRONT
+{
+  public:
+    int   np;                  // size of the grid, for which the arrays are set up
+    int   ne;
+
+    int   valid;               // front has been set up by a complete dry/rewet check
+    int   nNode;               // nodes of the elements elem[]
+    int*  node;
+    int   nElem;               // elements near the wet/dry line in ascending order
+    int*  elem;
+
+    int*  conStart;            // region elements connected to node n, dry elements included:
+    int*  conElem;             //   conElem[conStart[n]] ... conElem[conStart[n+1]-1]
+
+    char* ndFlag;              // scratch flags
+    char* elFlag;
+
+  public:
+    DRYFRONT()
+    {
+      np      = 0;
+      ne      = 0;
+
+      valid   = false;
+      nNode   = 0;
+      node    = NULL;
+      nElem   = 0;
+      elem    = NULL;
+
+      conStart = NULL;
+      conElem  = NULL;
+
+      ndFlag  = NULL;
+      elFlag  = NULL;
+    };
+
+    ~DRYFRONT();
+
+    void Free();
 };
 
 
@@ -131,6 +234,15 @@ class GRID
     static DRYREW dryRew;
     int    firstDryRew;
 
+    GEOM   geom;               // element geometry at Gauss points (see Geometry)
+
+    CHANGES fricChange;        // node state at last evaluation of friction and...
+    CHANGES turbChange;        // ...of eddy viscosity (see MODEL::DoFriction)
+
+    BUCKET bucket;             // spatial index of nodes and elements (see InitS)
+
+    DRYFRONT dryFront;         // wet/dry line of the last check (see SetFront)
+
   public:
     // Grid.cpp ------------------------------------------------------------------------------------
     GRID();
@@ -170,6 +282,8 @@ class GRID
 
     // Courant.cpp ---------------------------------------------------------------------------------
     double ReportCuPe( double, double );
+    void   MaxCuPe( double, double, double*, double* );
+    void   LocalTime( PROJECT*, double*, int );
 
     // Dispersion.cpp ------------------------------------------------------------------------------
     void   Dispersion( PROJECT* project, double* Duu, double* Dvv,
@@ -179,8 +293,13 @@ class GRID
     int    Dry( double, int );
     int    Rewet( double, int, PROJECT* );
     void   ReportDry( PROJECT*, double, int );
-    void   DryRewet(double dryLimit, double rewetLimit, int countDown, int *dried, int *wetted );
+    void   DryRewet(double dryLimit, double rewetLimit, int countDown, int *dried, int *wetted,
+                    int nnode =0, int* ndList =NULL, int nelem =0, int* elList =NULL );
     void   RewetDry(double dryLimit, double rewetLimit, int countDown, int *dried, int *wetted );
+    void   SetFront( int nel, int* list );
+
+    // Geom.cpp ------------------------------------------------------------------------------------
+    double* Geometry( ELEM*, double* local );
 
     // EddyDisp.cpp --------------------------------------------------------------------------------
     void   EddyDisp();
@@ -202,7 +321,7 @@ class GRID
 
     // Smooth.cpp ----------------------------------------------------------------------------------
     void   SmoothS( int );
-    void   SmoothKD( int );
+    void   SmoothKD( int, char* =NULL );
 
     // VeloGrad.cpp --------------------------------------------------------------------------------
     void VeloGrad( PROJECT* p, double* dUdx, double* dUdy, double* dVdx, double* dVdy );
@@ -67,8 +67,10 @@
 
 #include "Defs.h"
 #include "Report.h"
+#include "Memory.h"
 #include "Elem.h"
 #include "Node.h"
+#include "Grid.h"
 #include "Model.h"
 #include "Project.h"
 #include "CRSMat.h"
@@ -90,13 +92,7 @@ void EQS::KillCrsm()
 
 void EQS::SetIndexMat( MODEL* model, int mceq )
 {
-  int   i, j, k;
-  int   l, n, ceq;
-  int   row, col;
-  int*  indPtr;
   char  text[100];
-  NODE* ndR;
-  NODE* ndC;
 
 
   // allocate memory for index matrix ----------------------------------------------------
@@ -112,180 +108,185 @@ void EQS::SetIndexMat( MODEL* model, int mceq )
   int*  width = crsm->m_width;
   int** index = crsm->m_index;
 
+  for( int i=0; i<neq; i++ )  width[i] = 0;
 
-  // initialization of index matrix and width arrays -------------------------------------
 
-  j = mceq * neq;
+  // elements connected to nodes in the order of the model element list -----------------
+  // the rows are set up one by one with the columns in the same order as they occur
+  // during assembling; stamp[col] == row marks the columns already in row
+  // with stable equation numbers (see SetEqno) the index matrix is set up for all nodes
+  // and elements of the region
 
-  for( i=0; i<j;   i++ )  index[0][i] = -1;
-  for( i=0; i<neq; i++ )  width[i]    =  0;
+  GRID* rg   = model->region;
+  int   rgnp = rg->Getnp();
 
+  int   ne   = stable? rg->Getne() : model->ne;
+  int   np   = stable? rgnp        : model->np;
 
-  // set up index matrix -----------------------------------------------------------------
+  int size = 0;
+  for( int e=0; e<ne; e++ )
+  {
+    ELEM* elem = stable? rg->Getelem(e) : model->elem[e];
+    size += elem->Getnnd();
+  }
+
+  int*   start = (int*)   MEMORY::memo.Array( rgnp+1 );
+  ELEM** conn  = (ELEM**) MEMORY::memo.Array( size );
+  int*   stamp = (int*)   MEMORY::memo.Array_eq( neq );
 
-  for( int e=0; e<model->ne; e++ )
+  for( int n=0; n<=rgnp; n++ )  start[n] = 0;
+
+  for( int e=0; e<ne; e++ )
   {
-    ELEM* elem = model->elem[e];
+    ELEM* elem = stable? rg->Getelem(e) : model->elem[e];
 
     int nnd = elem->Getnnd();
+    for( int i=0; i<nnd; i++ )  start[elem->nd[i]->Getno()+1]++;
+  }
+
+  for( int n=0; n<rgnp; n++ )  start[n+1] += start[n];
+
+  for( int e=0; e<ne; e++ )
+  {
+    ELEM* elem = stable? rg->Getelem(e) : model->elem[e];
+
+    int nnd = elem->Getnnd();
+    for( int i=0; i<nnd; i++ )  conn[start[elem->nd[i]->Getno()]++] = elem;
+  }
+
+  for( int n=rgnp; n>0; n-- )  start[n] = start[n-1];
+  start[0] = 0;
+
+  for( int i=0; i<neq; i++ )  stamp[i] = -1;
+
+
+  // set up index matrix: rows of node equations -----------------------------------------
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* ndR = stable? rg->Getnode(n) : model->node[n];
+    int   no  = ndR->Getno();
 
-    for( i=0; i<nnd; i++ )
+    if( start[no] == start[no+1] )  continue;
+
+    for( int j=0; j<dfcn; j++ )
     {
-      ndR = elem->nd[i];
+      int row = GetIndexEqno( ndR, j );
+
+      if( row < 0 )  continue;
+
+      int* indPtr = index[row];
+
+      indPtr[0]   = row;
+      width[row]  = 1;
+      stamp[row]  = row;
 
-      for( j=0; j<dfcn; j++ )
+      for( int c=start[no]; c<start[no+1]; c++ )
       {
-        row = GetEqno( ndR, j );
+        ELEM* elem = conn[c];
 
-        if( row >= 0 )
-        {
-          indPtr = index[row];
+        int nnd = elem->Getnnd();
 
-          if( !width[row] )
-          {
-            width[row] = 1;
-            indPtr[0]  = row;
-          }
+        for( int k=0; k<nnd; k++ )
+        {
+          NODE* ndC = elem->nd[k];
 
-          for( k=0; k<nnd; k++ )
+          for( int l=0; l<dfcn; l++ )
           {
-            ndC = elem->nd[k];
+            int col = GetIndexEqno( ndC, l );
 
-            for( l=0; l<dfcn; l++ )
+            if( col >= 0  &&  stamp[col] != row )
             {
-              col = GetEqno( ndC, l );
-
-              if( col >= 0 )
-              {
-                for( n=0; n<width[row]; n++ )
-                {
-                  if( indPtr[n] == col )
-                  {
-                    n = -1;
-                    break;
-                  }
-                }
-
-                if( n >= 0 )
-                {
-                  if( width[row] >= mceq )
-                    REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
-
-                  indPtr[ width[row] ] = col;
-
-                  width[row]++;
-                }
-              }
+              if( width[row] >= mceq )
+                REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
+
+              stamp[col] = row;
+              indPtr[ width[row] ] = col;
+              width[row]++;
             }
           }
+        }
 
+        for( int l=0; l<dfel; l++ )
+        {
+          int col = GetIndexEqno( elem, l );
 
-          for( l=0; l<dfel; l++ )
+          if( col >= 0  &&  stamp[col] != row )
           {
-            col = GetEqno( elem, l );
+            if( width[row] >= mceq )
+              REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
 
-            if( col >= 0 )
-            {
-              for( n=0; n<width[row]; n++ )
-              {
-                if( indPtr[n] == col )
-                {
-                  n = -1;
-                  break;
-                }
-              }
-
-              if( n >= 0 )
-              {
-                if( width[row] >= mceq )
-                  REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
-
-                indPtr[ width[row] ] = col;
-
-                width[row]++;
-              }
-            }
+            stamp[col] = row;
+            indPtr[ width[row] ] = col;
+            width[row]++;
           }
         }
       }
     }
+  }
+
 
+  // rows of element equations -----------------------------------------------------------
+
+  for( int e=0; e<ne; e++ )
+  {
+    ELEM* elem = stable? rg->Getelem(e) : model->elem[e];
 
-    for( j=0; j<dfel; j++ )
+    int nnd = elem->Getnnd();
+
+    for( int j=0; j<dfel; j++ )
     {
-      row = GetEqno( elem, j );
+      int row = GetIndexEqno( elem, j );
 
-      if( row >= 0 )
-      {
-        indPtr = index[row];
+      if( row < 0 )  continue;
 
-        if( !width[row] )
-        {
-          width[row] = 1;
-          indPtr[0]  = row;
-        }
+      int* indPtr = index[row];
+
+      indPtr[0]   = row;
+      width[row]  = 1;
+      stamp[row]  = row;
+
+      for( int k=0; k<nnd; k++ )
+      {
+        NODE* ndC = elem->nd[k];
 
-        for( k=0; k<nnd; k++ )
+        for( int l=0; l<dfcn; l++ )
         {
-          ndC = elem->nd[k];
+          int col = GetIndexEqno( ndC, l );
 
-          for( l=0; l<dfcn; l++ )
+          if( col >= 0  &&  stamp[col] != row )
           {
-            col = GetEqno( ndC, l );
+            if( width[row] >= mceq )
+              REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
 
-            if( col >= 0 )
-            {
-              for( n=0; n<width[row]; n++ )
-              {
-                if( indPtr[n] == col )
-                {
-                  n = -1;
-                  break;
-                }
-              }
-
-              if( n >= 0 )
-              {
-                if( width[row] >= mceq )
-                  REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
-
-                indPtr[ width[row] ] = col;
-
-                width[row]++;
-              }
-            }
+            stamp[col] = row;
+            indPtr[ width[row] ] = col;
+            width[row]++;
           }
         }
+      }
 
+      for( int l=0; l<dfel; l++ )
+      {
+        int col = GetIndexEqno( elem, l );
 
-        for( l=0; l<dfel; l++ )
+        if( col >= 0  &&  stamp[col] != row )
         {
-          col = GetEqno( elem, l );
+          if( width[row] >= mceq )
+            REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
 
-          if( col >= 0 )
-          {
-            for( n=0; n<width[row]; n++ )
-            {
-              if( indPtr[n] == col )
-              {
-                n = -1;
-                break;
-              }
-            }
-
-            if( n >= 0 )
-            {
-              if( width[row] >= mceq )
-                REPORT::rpt.Error( "overflow in maximum connection: increase mceq!" );
-
-              indPtr[ width[row] ] = col;
-              width[row]++;
-            }
-          }
+          stamp[col] = row;
+          indPtr[ width[row] ] = col;
+          width[row]++;
         }
       }
     }
   }
+
+  MEMORY::memo.Detach( start );
+  MEMORY::memo.Detach( conn );
+  MEMORY::memo.Detach( stamp );
+
 /*
   if( solverType == kBicgstab_imp_3 )
   {
@@ -327,9 +328,10 @@ void EQS::SetIndexMat( MODEL* model, int mceq )
     delete[] owidth;
   }
 */
-  ceq = 0;
 
-  for( i=0; i<neq; i++ )
+  int ceq = 0;
+
+  for( int i=0; i<neq; i++ )
   {
     if( width[i] > ceq ) ceq = width[i];
   }
@@ -33,6 +33,7 @@
 
 #include "Defs.h"
 #include "Report.h"
+#include "Memory.h"
 #include "Type.h"
 #include "Node.h"
 #include "Elem.h"
@@ -42,29 +43,59 @@
 #include "Grid.h"
 
 
+// ---------------------------------------------------------------------------------------
+// Initialize the water surface by interpolation between sections: a node gets the value
+// of the first pair of sections, whose strip contains the node. Only nodes inside of the
+// bounding box of a strip are tested, which are found with the spatial index GRID::bucket.
+
 void GRID::InitS( int nSection, SECTION* section )
 {
-  for( int i=0; i<np; i++ )
+  if( nSection == 1 )
+  {
+    for( int i=0; i<np; i++ )  node[i].v.S = section[0].z;
+    return;
+  }
+
+  bucket.Build( this );
+
+  char* done = (char*) MEMORY::memo.Array_nd( np );
+  int*  list = (int*)  MEMORY::memo.Array_nd( np );
+
+  for( int i=0; i<np; i++ )  done[i] = false;
+
+  for( int j=0; j<nSection-1; j++ )
   {
-    NODE* nd = &node[i];
+    int    n;
+    double xmin, ymin, xmax, ymax;
 
-    if( nSection == 1 )
+    if( section[j].strip(&section[j+1], &xmin, &ymin, &xmax, &ymax) )
     {
-      nd->v.S = section[0].z;
+      n = bucket.Nodes( xmin, ymin, xmax, ymax, list );
     }
-
     else
     {
-      for( int j=0; j<nSection-1; j++ )
-      {
-        double S;
+      // no bounding box for the strip: test all nodes
+      n = np;
+      for( int i=0; i<np; i++ )  list[i] = i;
+    }
+
+    for( int k=0; k<n; k++ )
+    {
+      int i = list[k];
 
-        if( section[j].interpolate(&section[j+1], nd->x, nd->y, &S) )
-        {
-          nd->v.S = S;
-          break;
-        }
+      if( done[i] )  continue;
+
+      NODE*  nd = &node[i];
+      double S;
+
+      if( section[j].interpolate(&section[j+1], nd->x, nd->y, &S) )
+      {
+        nd->v.S = S;
+        done[i] = true;
       }
     }
   }
+
+  MEMORY::memo.Detach( done );
+  MEMORY::memo.Detach( list );
 }
@@ -31,93 +31,329 @@
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
+
 #include "Defs.h"
+#include "Report.h"
 #include "Node.h"
 #include "Elem.h"
 
 #include "Model.h"
 
 
-double DRYREW::interpolate( NODE *node, int var, int depth )
+#define kMaxDepth   8          // maximum depth of the k-ring in interpolate()
+#define kMaxVar    12          // maximum number of variables in one call
+
+
+DRYREW::~DRYREW()
 {
-  double val = 0.0;
-  double dis = 0.0;
+  delete[] adjStart;
+  delete[] adjNode;
+  delete[] adjWgt;
+
+  delete[] stamp;
+  delete[] ringPos;
+  delete[] ring;
+  delete[] ringVal;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Set up the adjacency of nodes to the corner nodes of connected region elements, as
+// seen by interpolate(). A corner node shared by several elements is listed once with
+// the inverse distance weight accumulated over the elements.
+
+void DRYREW::Connect( GRID* rg )
+{
+  if( adjValid  &&  adjGrid == rg )  return;
+
+  int np = rg->Getnp();
+
+  if( np > nAdjNode )
+  {
+    delete[] adjStart;
+    delete[] stamp;
+    delete[] ringPos;
+    delete[] ring;
+
+    adjStart = new int [np+1];
+    stamp    = new int [np];
+    ringPos  = new int [np];
+    ring     = new int [np];
+
+    if( !adjStart || !stamp || !ringPos || !ring )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - DRYREW::Connect(1)" );
+
+    nAdjNode = np;
+  }
+
+  for( int i=0; i<np; i++ )  stamp[i] = 0;
+  curStamp = 0;
+
+
+  // upper bound of adjacency size -------------------------------------------------------
+
+  int size = 0;
+
+  for( int i=0; i<np; i++ )
+  {
+    NODE* nd = rg->Getnode(i);
+
+    for( int e=0; e<(int)nd->noel; e++ )  size += nd->el[e]->Getncn();
+  }
+
+  if( size > nAdjBuf )
+  {
+    delete[] adjNode;
+    delete[] adjWgt;
+
+    adjNode = new int [size];
+    adjWgt  = new double [size];
+
+    if( !adjNode || !adjWgt )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - DRYREW::Connect(2)" );
+
+    nAdjBuf = size;
+  }
+
+
+  // adjacent corner nodes and weights ---------------------------------------------------
 
-  int k    = 0;
-  int noel = node->noel;
+  int cnt = 0;
 
-  for( int i=0; i<noel; i++ )
+  for( int i=0; i<np; i++ )
   {
-    ELEM* el = (ELEM *) node->el[i];
+    NODE* nd = rg->Getnode(i);
 
-    int ncn = el->Getncn();
+    adjStart[i] = cnt;
+    curStamp++;
 
-    if( isFS(el->flag, ELEM::kRegion) )
+    for( int e=0; e<(int)nd->noel; e++ )
     {
+      ELEM* el = nd->el[e];
+
+      if( !isFS(el->flag, ELEM::kRegion) )  continue;
+
+      int ncn = el->Getncn();
+
       for( int j=0; j<ncn; j++ )
       {
-        if( depth > 0 )
-        {
-          if( node != el->nd[j] )
-          {
-            double dx = node->x - el->nd[j]->x;
-            double dy = node->y - el->nd[j]->y;
+        NODE* ndj = el->nd[j];
 
-            double d = sqrt( dx*dx + dy*dy );
+        if( ndj == nd )  continue;
 
-            double v = interpolate( el->nd[j], var, depth-1 );
+        int m = ndj->Getno();
 
-            if( fabs(v) > 1.0e-30 )
-            {
-              val +=   v / d;
-              dis += 1.0 / d;
+        double dx = nd->x - ndj->x;
+        double dy = nd->y - ndj->y;
 
-              k++;
-            }
-          }
-        }
+        double w = 1.0 / sqrt( dx*dx + dy*dy );
 
+        if( stamp[m] != curStamp )
+        {
+          stamp[m]     = curStamp;
+          ringPos[m]   = cnt;
+          adjNode[cnt] = m;
+          adjWgt[cnt]  = w;
+          cnt++;
+        }
         else
         {
-          double U = el->nd[j]->v.U;
-          double V = el->nd[j]->v.V;
+          adjWgt[ringPos[m]] += w;
+        }
+      }
+    }
+  }
 
-          double S = el->nd[j]->v.S;
-          double A = el->nd[j]->z;
-          double H = S - A;
+  adjStart[np] = cnt;
 
-          double v = 0.0;
+  adjGrid  = rg;
+  adjValid = true;
+}
 
-          switch( var )
-          {
-            case kVarU:   v = U;                    break;
-            case kVarV:   v = V;                    break;
-            case kVarH:   v = H;                    break;
-            case kVarS:   v = S;                    break;
-            case kVarK:   v = el->nd[j]->v.K;       break;
-            case kVarD:   v = el->nd[j]->v.D;       break;
-
-            case kVarUH:  v = U * H;                break;
-            case kVarVH:  v = V * H;                break;
-          }
 
-          if( node != el->nd[j]  &&  !isFS(el->nd[j]->flag, NODE::kDry) )
-          {
-            k++;
+// ---------------------------------------------------------------------------------------
+// Inverse distance interpolation of the variables var[0..nvar-1] at a node. With depth 0
+// the values are averaged from adjacent wet nodes, with depth k from the interpolations
+// of depth k-1 at adjacent nodes, which are non-zero. The nodes up to k edges apart are
+// gathered breadth-first and the interpolation is done level by level, so that every
+// node in the k-ring is evaluated once per level.
+
+static double nodeValue( NODE* nd, int var )
+{
+  double U = nd->v.U;
+  double V = nd->v.V;
+  double S = nd->v.S;
+  double H = S - nd->z;
+
+  switch( var )
+  {
+    case kVarU:   return U;
+    case kVarV:   return V;
+    case kVarH:   return H;
+    case kVarS:   return S;
+    case kVarK:   return nd->v.K;
+    case kVarD:   return nd->v.D;
+
+    case kVarUH:  return U * H;
+    case kVarVH:  return V * H;
+  }
+
+  return 0.0;
+}
+
+
+double DRYREW::interpolate( NODE *node, int var, int depth )
+{
+  double val;
+
+  interpolate( node, depth, 1, &var, &val );
 
-            double dx = node->x - el->nd[j]->x;
-            double dy = node->y - el->nd[j]->y;
+  return val;
+}
 
-            double d = sqrt( dx*dx + dy*dy );
 
-            val +=   v / d;
-            dis += 1.0 / d;
+void DRYREW::interpolate( NODE* node, int depth, int nvar, const int* var, double* val )
+{
+  if( !adjValid )
+    REPORT::rpt.Error( kUnexpectedFault, "adjacency not set up - DRYREW::interpolate(1)" );
+
+  if( depth > kMaxDepth  ||  nvar > kMaxVar )
+    REPORT::rpt.Error( kParameterFault, "too many levels or variables - DRYREW::interpolate(2)" );
+
+
+  // gather the k-ring breadth-first: ring[0..end[h]-1] are nodes up to h edges apart -----
+
+  int end[kMaxDepth+1];
+
+  curStamp++;
+
+  int no = node->Getno();
+
+  stamp[no]   = curStamp;
+  ringPos[no] = 0;
+  ring[0]     = no;
+
+  end[0] = 1;
+
+  for( int h=1; h<=depth; h++ )
+  {
+    int n = end[h-1];
+
+    for( int r=(h>1)? end[h-2] : 0; r<end[h-1]; r++ )
+    {
+      int i = ring[r];
+
+      for( int a=adjStart[i]; a<adjStart[i+1]; a++ )
+      {
+        int m = adjNode[a];
+
+        if( stamp[m] != curStamp )
+        {
+          stamp[m]   = curStamp;
+          ringPos[m] = n;
+          ring[n++]  = m;
+        }
+      }
+    }
+
+    end[h] = n;
+  }
+
+  int size = 2 * end[depth] * nvar;
+
+  if( size > nRingVal )
+  {
+    delete[] ringVal;
+
+    ringVal = new double [size];
+
+    if( !ringVal )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - DRYREW::interpolate(3)" );
+
+    nRingVal = size;
+  }
+
+  double* prev = ringVal;
+  double* curr = ringVal + end[depth] * nvar;
+
+
+  // level 0: average of wet adjacent nodes ----------------------------------------------
+
+  for( int r=0; r<end[depth]; r++ )
+  {
+    int i = ring[r];
+    int k = 0;
+
+    double  dis = 0.0;
+    double* f   = curr + r*nvar;
+
+    for( int v=0; v<nvar; v++ )  f[v] = 0.0;
+
+    for( int a=adjStart[i]; a<adjStart[i+1]; a++ )
+    {
+      NODE* nd = adjGrid->Getnode( adjNode[a] );
+
+      if( isFS(nd->flag, NODE::kDry) )  continue;
+
+      double w = adjWgt[a];
+
+      for( int v=0; v<nvar; v++ )  f[v] += nodeValue( nd, var[v] ) * w;
+
+      dis += w;
+      k++;
+    }
+
+    for( int v=0; v<nvar; v++ )
+    {
+      if( k )  f[v] /= dis;
+      else     f[v]  = 0.0;
+    }
+  }
+
+
+  // level t: average of non-zero values of level t-1 at adjacent nodes -----------------
+
+  for( int t=1; t<=depth; t++ )
+  {
+    double* tmp = prev;
+    prev = curr;
+    curr = tmp;
+
+    for( int r=0; r<end[depth-t]; r++ )
+    {
+      int i = ring[r];
+
+      double dis[kMaxVar];
+      double* f = curr + r*nvar;
+
+      for( int v=0; v<nvar; v++ )
+      {
+        f[v]   = 0.0;
+        dis[v] = 0.0;
+      }
+
+      for( int a=adjStart[i]; a<adjStart[i+1]; a++ )
+      {
+        double  w = adjWgt[a];
+        double* g = prev + ringPos[adjNode[a]]*nvar;
+
+        for( int v=0; v<nvar; v++ )
+        {
+          if( fabs(g[v]) > 1.0e-30 )
+          {
+            f[v]   += g[v] * w;
+            dis[v] += w;
           }
         }
       }
+
+      for( int v=0; v<nvar; v++ )
+      {
+        if( dis[v] > 0.0 )  f[v] /= dis[v];
+        else                f[v]  = 0.0;
+      }
     }
   }
 
-  if( k )  return val / dis;
-  else     return 0.0;
+  for( int v=0; v<nvar; v++ )  val[v] = curr[v];
 }
@@ -55,6 +55,12 @@
 #define kMaxIter    200
 #define kPrecision  1.0e-3
 
+#define kDragRate   16         // grid points per decade of the drag table
+#define kDragLu     -3.0       // log10 of velocity range  [1.0e-3, 1.0e1]
+#define kDragNu     4
+#define kDragLh     -3.0       // log10 of depth range     [1.0e-3, 1.0e2]
+#define kDragNh     5
+
 int TYPE::cWRav    = 0;
 int TYPE::cWRmax   = 0;
 int TYPE::cWRcount = 0;
@@ -64,6 +70,7 @@ int TYPE::aNLcount = 0;
 int TYPE::itErr    = 0;
 
 double TYPE::_cWR  = 0.0;      // drag coefficient of vegetation
+double TYPE::dragTol = 0.0;    // error bound of the drag table (0.0: no table)
 double TYPE::_aNL  = 0.0;      // wake length
 double TYPE::_Ust  = 0.0;      // ratio of flow velocity
 double TYPE::_Hst  = 0.0;      // ratio of flow depth
@@ -377,3 +384,250 @@ void TYPE::statisLindner()
   cWRmax = cWRav = cWRcount = 0;
   itErr  = 0;
 }
+
+
+// --------------------------------------------------------------------------------------
+// table of drag coefficients for non-submerged vegetation
+// --------------------------------------------------------------------------------------
+
+DRAGTAB::DRAGTAB()
+{
+  rate  = 0;
+  nu    = nh = 0;
+  lu0   = lh0 = 0.0;
+  cWR   = NULL;
+  exact = NULL;
+
+  for( int i=0; i<5; i++ )  key[i] = 0.0;
+}
+
+
+DRAGTAB::~DRAGTAB()
+{
+  Free();
+}
+
+
+void DRAGTAB::Free()
+{
+  if( cWR )    delete[] cWR;
+  if( exact )  delete[] exact;
+
+  cWR   = NULL;
+  exact = NULL;
+  nu    = nh = 0;
+}
+
+
+void DRAGTAB::Alloc( int r )
+{
+  Free();
+
+  rate = r;
+  nu   = kDragNu * rate + 1;
+  nh   = kDragNh * rate + 1;
+  lu0  = kDragLu;
+  lh0  = kDragLh;
+
+  cWR   = new double [nu*nh];
+  exact = new char [(nu-1)*(nh-1)];
+
+  if( !cWR  ||  !exact )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - DRAGTAB::Alloc(1)" );
+}
+
+
+void DRAGTAB::Interpolate( int n, double* va, double* ha, double* c )
+{
+  for( int i=0; i<n; i++ )
+  {
+    c[i] = -1.0;
+
+    if( !cWR  ||  va[i] <= 0.0  ||  ha[i] <= 0.0 )  continue;
+
+    double x = rate * (log10(va[i]) - lu0);
+    double y = rate * (log10(ha[i]) - lh0);
+
+    if( x < 0.0  ||  y < 0.0  ||  x >= nu-1  ||  y >= nh-1 )  continue;
+
+    int iu = (int) x;
+    int ih = (int) y;
+
+    if( exact[ih*(nu-1) + iu] )  continue;
+
+    double  fx = x - iu;
+    double  fy = y - ih;
+    double* p  = cWR + ih*nu + iu;
+
+    c[i] = (1.0-fy) * ((1.0-fx)*p[0]  + fx*p[1])
+         +      fy  * ((1.0-fx)*p[nu] + fx*p[nu+1]);
+  }
+}
+
+
+// --------------------------------------------------------------------------------------
+// Methode TYPE::dragBuild()
+// --------------------------------------------------------------------------------------
+// The table is built on first use, if an error bound dragTol > 0.0 is given, since the
+// physical constants are known after the input of the project only, and it is rebuilt
+// if one of them changes. The drag coefficient is evaluated with the bottom friction of
+// the material at the grid points and checked at the centre and the four quarter points
+// of each cell: cells missing the error bound at one of them, mostly near critical flow
+// where cWR is not smooth, are flagged for the exact iteration. Materials with the same
+// vegetation and bottom roughness share the table.
+
+void TYPE::dragBuild( double ka, double vk, double g, double d90 )
+{
+  if( dragTol <= 0.0 )
+  {
+    if( drag.cWR )  drag.Free();
+    return;
+  }
+
+  double key[5] = { ka, vk, g, d90, dragTol };
+
+  if( drag.cWR  &&  !memcmp(drag.key, key, sizeof(key)) )  return;
+
+  // look for a material with equal parameters ------------------------------------------
+  for( int t=0; t<nType; t++ )
+  {
+    TYPE* type = &pType[t];
+
+    if(    type != this  &&  type->drag.cWR
+        && !memcmp(type->drag.key, key, sizeof(key))
+        && type->dp[0] == dp[0]      &&  type->sp[0] == sp[0]
+        && type->rtype == rtype      &&  type->rcoef == rcoef
+        && type->kslaw == kslaw      &&  type->ksfact == ksfact )
+    {
+      drag.Alloc( type->drag.rate );
+
+      memcpy( drag.cWR,   type->drag.cWR,   drag.nu*drag.nh*sizeof(double) );
+      memcpy( drag.exact, type->drag.exact, (drag.nu-1)*(drag.nh-1)*sizeof(char) );
+      memcpy( drag.key,   key,              sizeof(key) );
+
+      return;
+    }
+  }
+
+  // the statistics of iterations are not affected by the table
+  int statis[7] = { cWRav, cWRmax, cWRcount, aNLav, aNLmax, aNLcount, itErr };
+
+  drag.Alloc( kDragRate );
+
+  int     nu = drag.nu;
+  int     nh = drag.nh;
+  double  dl = 1.0 / drag.rate;
+
+  // drag coefficients at grid points ---------------------------------------------------
+  for( int ih=0; ih<nh; ih++ )
+  {
+    double ha = pow( 10.0, drag.lh0 + ih*dl );
+
+    for( int iu=0; iu<nu; iu++ )
+    {
+      double va = pow( 10.0, drag.lu0 + iu*dl );
+      double cb = grain( va, ha, ka, vk, g, d90, 0.0, 0.0 );
+
+      if( lindner(dp[0], sp[0], va, ha, cb, vk, g) < -0.9 )  drag.cWR[ih*nu + iu] = -1.0;
+      else                                                    drag.cWR[ih*nu + iu] = _cWR;
+    }
+  }
+
+  // check interpolation at the centre and the quarter points of cells -----------------
+  const double fx[5] = { 0.5, 0.25, 0.75, 0.25, 0.75 };
+  const double fy[5] = { 0.5, 0.25, 0.25, 0.75, 0.75 };
+
+  int    ncell  = (nu-1) * (nh-1);
+  int    nexact = 0;
+  double maxErr = 0.0;
+
+  for( int ih=0; ih<nh-1; ih++ )
+  {
+    for( int iu=0; iu<nu-1; iu++ )
+    {
+      double* p  = drag.cWR + ih*nu + iu;
+      char*   ex = drag.exact + ih*(nu-1) + iu;
+
+      *ex = true;
+      nexact++;
+
+      if( p[0] < 0.0  ||  p[1] < 0.0  ||  p[nu] < 0.0  ||  p[nu+1] < 0.0 )  continue;
+
+      double err = 0.0;
+      int    k;
+
+      for( k=0; k<5; k++ )
+      {
+        double va = pow( 10.0, drag.lu0 + (iu+fx[k])*dl );
+        double ha = pow( 10.0, drag.lh0 + (ih+fy[k])*dl );
+        double cb = grain( va, ha, ka, vk, g, d90, 0.0, 0.0 );
+
+        if( lindner(dp[0], sp[0], va, ha, cb, vk, g) < -0.9 )  break;
+
+        double c = (1.0-fy[k]) * ((1.0-fx[k])*p[0]  + fx[k]*p[1])
+                 +      fy[k]  * ((1.0-fx[k])*p[nu] + fx[k]*p[nu+1]);
+
+        double e = fabs(c - _cWR) / _cWR;
+
+        if( e > dragTol )  break;
+        if( e > err )      err = e;
+      }
+
+      if( k < 5 )  continue;
+
+      if( err > maxErr )  maxErr = err;
+
+      *ex = false;
+      nexact--;
+    }
+  }
+
+  memcpy( drag.key, key, sizeof(key) );
+
+  cWRav    = statis[0];
+  cWRmax   = statis[1];
+  cWRcount = statis[2];
+  aNLav    = statis[3];
+  aNLmax   = statis[4];
+  aNLcount = statis[5];
+  itErr    = statis[6];
+
+  REPORT::rpt.Message( 3, "\n (TYPE::dragBuild)       %s %d: %d x %d, %d of %d cells exact,"
+                          " maximum error %.2e\n",
+                       "drag table of type", _id, nu, nh, nexact, ncell, maxErr );
+}
+
+
+// --------------------------------------------------------------------------------------
+// Methode TYPE::vegetation()
+// --------------------------------------------------------------------------------------
+
+double TYPE::vegetation( double va, double ha, double cf, double vk, double g )
+{
+  double cWR;
+
+  drag.Interpolate( 1, &va, &ha, &cWR );
+
+  if( cWR >= 0.0  &&  dp[0] >= 1.0e-4  &&  sp[0] >= 1.0e-4 )
+  {
+    _cWR = cWR;
+    return cf  +  0.5 * cWR * ha * dp[0] / sp[0] / sp[0];
+  }
+
+  return lindner( dp[0], sp[0], va, ha, cf, vk, g );
+}
+
+
+void TYPE::vegetation( int n, double* va, double* ha, double* cf, double* cp,
+                       double vk, double g )
+{
+  drag.Interpolate( n, va, ha, cp );
+
+  double ds = 0.5 * dp[0] / sp[0] / sp[0];
+
+  for( int i=0; i<n; i++ )
+  {
+    if( cp[i] >= 0.0 )  cp[i] = cf[i]  +  cp[i] * ha[i] * ds;
+    else                cp[i] = lindner( dp[0], sp[0], va[i], ha[i], cf[i], vk, g );
+  }
+}
@@ -36,60 +36,75 @@
 
 #include "Memory.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _HUGEPAGES
+#include <sys/mman.h>
+#define kHugePage  (2*1024*1024)
+#endif
+
 
 MEMORY MEMORY::memo;
 
 
-MEMORY::MEMORY( int array )
+MEMORY::MEMORY()
 {
   m_max_nnd = 0;
   m_max_nel = 0;
   m_max_neq = 0;
 
-  m_array = array;
+  m_nbytes  = 0;
+  m_nalloc  = 0;
+  m_nused   = 0;
+
+  m_peak_nbytes = 0;
+  m_peak_nalloc = 0;
+  m_peak_nused  = 0;
 
-  m_temp = new ITEM* [m_array];
-  m_size = new unsigned int [m_array];
-  m_flag = new unsigned int [m_array];
+  m_pool = new POOL [kThreads+1];
 
-  if( !m_temp || !m_size || !m_flag )
+  if( !m_pool )
     REPORT::rpt.Error( kMemoryFault, "can not allocate memory - MEMORY::MEMORY(1)" );
 
-  for( int i=0; i<m_array; i++ )
+  for( int t=0; t<=kThreads; t++ )
   {
-    m_temp[i] = NULL;
-    m_size[i] = 0;
-    m_flag[i] = 0;
+    for( int c=0; c<kClasses; c++ )  m_pool[t].free[c] = NULL;
   }
 }
 
 
 MEMORY::~MEMORY()
 {
-  for( int i=0; i<m_array; i++ )
+  for( int t=0; t<=kThreads; t++ )
   {
-    if( m_temp[i] )  Delete( i );
+    for( int c=0; c<kClasses; c++ )
+    {
+      while( m_pool[t].free[c] )
+      {
+        BLOCK* block = m_pool[t].free[c];
+        m_pool[t].free[c] = block->next;
+        Release( block );
+      }
+    }
   }
-  delete[] m_temp;
-  delete[] m_size;
-  delete[] m_flag;
+
+  delete[] m_pool;
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Array_nd(), Array_el() and Array_eq() hand out arrays of the actual maximum size of
+// their class. If the maximum grows, arrays of the previous size are released lazily,
+// when they are found in a free list or when they are detached.
+
 void* MEMORY::Array_nd( unsigned int nnd )
 {
   if( nnd > m_max_nnd )
   {
-    for( int i=0; i<m_array; i++ )
-    {
-      if( isFS(m_flag[i], kNd) )
-      {
-        if( !isFS(m_flag[i], kUsed) )  Delete(i);
-        else                           SF( m_flag[i], kDelete );
-      }
-    }
-
-    m_max_nnd = nnd;
+#   pragma omp critical (memory_class)
+    if( nnd > m_max_nnd )  m_max_nnd = nnd;
   }
 
   return Array( m_max_nnd, kNd );
@@ -100,16 +115,8 @@ void* MEMORY::Array_el( unsigned int nel )
 {
   if( nel > m_max_nel )
   {
-    for( int i=0; i<m_array; i++ )
-    {
-      if( isFS(m_flag[i], kEl) )
-      {
-        if( !isFS(m_flag[i], kUsed) )  Delete(i);
-        else                           SF( m_flag[i], kDelete );
-      }
-    }
-
-    m_max_nel = nel;
+#   pragma omp critical (memory_class)
+    if( nel > m_max_nel )  m_max_nel = nel;
   }
 
   return Array( m_max_nel, kEl );
@@ -120,16 +127,8 @@ void* MEMORY::Array_eq( unsigned int neq )
 {
   if( neq > m_max_neq )
   {
-    for( int i=0; i<m_array; i++ )
-    {
-      if( isFS(m_flag[i], kEq) )
-      {
-        if( !isFS(m_flag[i], kUsed) )  Delete(i);
-        else                           SF( m_flag[i], kDelete );
-      }
-    }
-
-    m_max_neq = neq;
+#   pragma omp critical (memory_class)
+    if( neq > m_max_neq )  m_max_neq = neq;
   }
 
   return Array( m_max_neq, kEq );
@@ -138,232 +137,342 @@ void* MEMORY::Array_eq( unsigned int neq )
 
 void* MEMORY::Array( unsigned int n, unsigned int flag )
 {
+  int cls = Class( flag );
+  int t   = Thread();
+
+  BLOCK* block = NULL;
+
+
   // -------------------------------------------------------------------------------------
-  // look for an array that fits "n"
+  // look for an array in the free list of this thread that fits "n"; threads beyond
+  // kThreads share the last free list, which is locked
 
-  for( int i=0; i<m_array; i++ )
+  if( t < kThreads )
   {
-    if( !isFS(m_flag[i], kUsed) && isFS(m_flag[i], flag) )
-    {
-      if( m_size[i] == n )
-      {
-        SF( m_flag[i], kUsed );
-        return m_temp[i];
-      }
-    }
+    block = Take( t, cls, n );
+  }
+  else
+  {
+#   pragma omp critical (memory_shared)
+    block = Take( t, cls, n );
+  }
+
+  if( block )
+  {
+    SF( block->flag, kUsed );
+    Account( 0, 1, 0 );
+
+    return (char*) block + kHeader;
   }
 
 
   // -------------------------------------------------------------------------------------
-  // if no fitting array was found:
-  // ... search for arrays that should be deleted
+  // if no fitting array was found: allocate a new one
 
-  for( int i=0; i<m_array; i++ )
-  {
-    if( !isFS(m_flag[i], kUsed)  &&  isFS(m_flag[i], kDelete) )
-    {
-      if( m_temp[i] )  delete[] m_temp[i];
+  block = Allocate( (size_t) n * sizeof(ITEM), n, flag );
 
-      if( !(m_temp[i] = new ITEM[n]) )
-        REPORT::rpt.Error( kMemoryFault, "can not allocate memory - MEMORY::Array(1)" );
+  if( !block )
+    REPORT::rpt.Error( kMemoryFault, "can not allocate memory - MEMORY::Array(1)" );
 
-      m_size[i] = n;
+  Account( 0, 1, 0 );
 
-      SF( m_flag[i], kUsed );
-      SF( m_flag[i], flag );
-      return m_temp[i];
-    }
-  }
+  return (char*) block + kHeader;
+}
+
+
+void MEMORY::Detach( void* temp )
+{
+  if( !temp )  return;
+
+  BLOCK* block = Block( temp );
+
+  if( !block  ||  !isFS(block->flag, kUsed) )
+    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Detach(1)" );
+
+  CF( block->flag, kUsed );
+  Account( 0, -1, 0 );
+
+  // 2-dimensional arrays and arrays of an outdated size are released immediately ...
 
-  // ... or search for unused arrays
+  int cls = Class( block->flag );
 
-  for( int i=0; i<m_array; i++ )
+  if(     isFS(block->flag, kImatrix)  ||  isFS(block->flag, kDmatrix)
+      ||  (cls != kClassAny  &&  block->size != Size(cls, block->size)) )
   {
-    if( !m_temp[i] )
-    {
-      if( !(m_temp[i] = new ITEM[n]) )
-        REPORT::rpt.Error( kMemoryFault, "can not allocate memory - MEMORY::Array(2)" );
+    Release( block );
+  }
 
-      m_size[i] = n;
+  // ... all others are kept in the free list of the detaching thread
 
-      SF( m_flag[i], kUsed );
-      SF( m_flag[i], flag );
-      return m_temp[i];
+  else
+  {
+    int t = Thread();
+
+    if( t < kThreads )
+    {
+      Put( t, cls, block );
+    }
+    else
+    {
+#     pragma omp critical (memory_shared)
+      Put( t, cls, block );
     }
   }
+}
 
-  // -------------------------------------------------------------------------------------
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Array(3)" );
+void MEMORY::Delete( void* temp )
+{
+  if( !temp )  return;
 
-  return NULL;
+  BLOCK* block = Block( temp );
+
+  if( !block )
+    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Delete(1)" );
+
+  if( isFS(block->flag, kUsed) )  Account( 0, -1, 0 );
+
+  Release( block );
 }
 
 
-void MEMORY::Detach( void* temp )
+int** MEMORY::Imatrix( unsigned int rows, unsigned int cols )
 {
-  for( int i=0; i<m_array; i++ )
+  // row pointers and data are allocated in one block
+
+  size_t rowBytes = ((rows * sizeof(int*) + kAlign - 1) / kAlign) * kAlign;
+
+  BLOCK* block = Allocate( rowBytes + (size_t) rows * cols * sizeof(int),
+                           rows * cols, kImatrix );
+  if( !block )
+    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Imatrix(1)" );
+
+  int** M = (int**) ((char*) block + kHeader);
+
+  M[0] = (int*) ((char*) M + rowBytes);
+
+  for( unsigned int i=1; i<rows; i++ )
   {
-    if( m_temp[i] == temp )
-    {
-      if( isFS(m_flag[i], kImatrix) )
-      {
-        Delete( i );
-      }
-      else if( isFS(m_flag[i], kDmatrix) )
-      {
-        Delete( i );
-      }
-      else
-      {
-        if( isFS(m_flag[i], kDelete) )  Delete( i );
-        else                            CF( m_flag[i], kUsed );
-      }
-      return;
-    }
+    M[i] = M[i-1] + cols;
   }
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Detach(1)" );
+  Account( 0, 1, 0 );
+
+  return M;
 }
 
 
-void MEMORY::Delete( void* temp )
+double** MEMORY::Dmatrix( unsigned int rows, unsigned int cols )
 {
-  for( int i=0; i<m_array; i++ )
+  // row pointers and data are allocated in one block
+
+  size_t rowBytes = ((rows * sizeof(double*) + kAlign - 1) / kAlign) * kAlign;
+
+  BLOCK* block = Allocate( rowBytes + (size_t) rows * cols * sizeof(double),
+                           rows * cols, kDmatrix );
+  if( !block )
+    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Dmatrix(1)" );
+
+  double** M = (double**) ((char*) block + kHeader);
+
+  M[0] = (double*) ((char*) M + rowBytes);
+
+  for( unsigned int i=1; i<rows; i++ )
   {
-    if( m_temp[i] == temp )  Delete( i );
-    return;
+    M[i] = M[i-1] + cols;
   }
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Delete(1)" );
+  Account( 0, 1, 0 );
+
+  return M;
 }
 
 
-void MEMORY::Delete( int i )
+void MEMORY::PrintInfo()
 {
-  if( m_temp[i] )
+  char text[300];
+
+  sprintf( text, "\n %s %lu %s\n %s %u arrays | %u in use\n %s %lu bytes | %u arrays | %u in use\n",
+                 "(MEMORY)               ", (unsigned long) m_nbytes,
+                 "bytes of memory allocated",
+                 "                       ", m_nalloc, m_nused,
+                 "high-water marks:      ", (unsigned long) m_peak_nbytes,
+                 m_peak_nalloc, m_peak_nused );
+  REPORT::rpt.Output( text, 3 );
+}
+
+
+// ---------------------------------------------------------------------------------------
+// private methods
+
+// index of the free list of the calling thread; threads beyond kThreads get the shared
+// list m_pool[kThreads]
+
+int MEMORY::Thread()
+{
+# ifdef _OPENMP
+  int t = omp_get_thread_num();
+  if( t > kThreads )  t = kThreads;
+  return t;
+# else
+  return 0;
+# endif
+}
+
+
+// ---------------------------------------------------------------------------------------
+// take an array that fits "n" from the free list t; arrays of an outdated class size are
+// released on the way
+
+MEMORY::BLOCK* MEMORY::Take( int t, int cls, unsigned int n )
+{
+  BLOCK** list = &m_pool[t].free[cls];
+
+  while( *list )
   {
-    if( isFS(m_flag[i], kImatrix) )
+    BLOCK* block = *list;
+
+    if( block->size == n )
     {
-      int** M = (int**) m_temp[i];
-      delete[] M[0];
-      delete[] M;
+      *list = block->next;
+      block->next = NULL;
+
+      return block;
     }
-    else if( isFS(m_flag[i], kDmatrix) )
+
+    if( cls != kClassAny  &&  block->size != Size(cls, block->size) )
     {
-      double** M = (double**) m_temp[i];
-      delete[] M[0];
-      delete[] M;
+      *list = block->next;
+      Release( block );
     }
     else
     {
-      delete[] m_temp[i];
+      list = &block->next;
     }
+  }
+
+  return NULL;
+}
 
-    m_temp[i] = NULL;
-    m_size[i] = 0;
-    m_flag[i] = 0;
 
-    return;
-  }
+void MEMORY::Put( int t, int cls, BLOCK* block )
+{
+  BLOCK** list = &m_pool[t].free[cls];
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Delete(1)" );
+  block->next = *list;
+  *list       = block;
 }
 
 
-int** MEMORY::Imatrix( unsigned int rows, unsigned int cols )
+int MEMORY::Class( unsigned int flag )
 {
-  int** M = new int* [ rows ];
-  if( !M )
-    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Imatrix(1)" );
+  if( isFS(flag, kNd) )  return kClassNd;
+  if( isFS(flag, kEl) )  return kClassEl;
+  if( isFS(flag, kEq) )  return kClassEq;
 
-  M[0] = new int[ rows * cols ];
-  if( !M[0] )
-    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Imatrix(2)" );
+  return kClassAny;
+}
 
-  for( unsigned int i=1; i<rows; i++ )
+
+// actual array size of a class; arrays of any size fit the class kClassAny
+
+unsigned int MEMORY::Size( int cls, unsigned int n )
+{
+  switch( cls )
   {
-    M[i] = M[i-1] + cols;
+    case kClassNd:  return m_max_nnd;
+    case kClassEl:  return m_max_nel;
+    case kClassEq:  return m_max_neq;
   }
 
-  for( int i=0; i<m_array; i++ )
-  {
-    if( !m_temp[i] )
-    {
-      m_temp[i] = (ITEM*) M;
-      m_size[i] = rows * cols;
+  return n;
+}
 
-      SF( m_flag[i], kUsed );
-      SF( m_flag[i], kImatrix );
 
-      return M;
-    }
-  }
+MEMORY::BLOCK* MEMORY::Block( void* ptr )
+{
+  if( !ptr )  return NULL;
 
+  BLOCK* block = (BLOCK*) ((char*) ptr - kHeader);
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Imatrix(3)" );
+  if( block->magic != (unsigned int) kMagic )  return NULL;
 
-  return NULL;}
+  return block;
+}
 
 
-double** MEMORY::Dmatrix( unsigned int rows, unsigned int cols )
+// ---------------------------------------------------------------------------------------
+// Allocate a new block and initialize it on the calling thread (first touch), so that
+// the pages are placed in the memory of the NUMA node which is going to use them.
+
+MEMORY::BLOCK* MEMORY::Allocate( size_t bytes, unsigned int size, unsigned int flag )
 {
-  double** M = new double* [ rows ];
-  if( !M )
-    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Dmatrix(1)" );
+  void*  ptr   = NULL;
+  size_t total = kHeader + bytes;
 
-  M[0] = new double[ rows * cols ];
-  if( !M[0] )
-    REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Dmatrix(2)" );
+# ifdef MS_WIN
+  ptr = _aligned_malloc( total, kAlign );
+# else
+  size_t align = kAlign;
 
-  for( unsigned int i=1; i<rows; i++ )
+# ifdef _HUGEPAGES
+  if( total >= kHugePage )
   {
-    M[i] = M[i-1] + cols;
+    align = kHugePage;
+    total = ((total + kHugePage - 1) / kHugePage) * kHugePage;
   }
+# endif
 
-  for( int i=0; i<m_array; i++ )
-  {
-    if( !m_temp[i] )
-    {
-      m_temp[i] = (ITEM*) M;
-      m_size[i] = rows * cols;
+  if( posix_memalign(&ptr, align, total) != 0 )  ptr = NULL;
 
-      SF( m_flag[i], kUsed );
-      SF( m_flag[i], kDmatrix );
+# ifdef _HUGEPAGES
+  if( ptr  &&  align == kHugePage )  madvise( ptr, total, MADV_HUGEPAGE );
+# endif
+# endif
 
-      return M;
-    }
-  }
+  if( !ptr )  return NULL;
 
+  memset( ptr, 0, total );
 
-  REPORT::rpt.Error( kUnexpectedFault, "unexpected internal fault - MEMORY::Dmatrix(3)" );
+  BLOCK* block = (BLOCK*) ptr;
 
-  return NULL;
+  block->next   = NULL;
+  block->bytes  = total;
+  block->size   = size;
+  block->flag   = flag | kUsed;
+  block->magic  = kMagic;
+  block->thread = Thread();
+
+  Account( 1, 0, (long) total );
+
+  return block;
 }
 
 
-void MEMORY::PrintInfo()
+void MEMORY::Release( BLOCK* block )
 {
-  unsigned int nused  = 0;
-  unsigned int nalloc = 0;
-  unsigned int nbytes = 0;
+  Account( -1, 0, -(long) block->bytes );
 
-  for( int i=0; i<m_array; i++ )
-  {
-    if( m_temp[i] )  nalloc++;
-    if( isFS(m_flag[i], kUsed) )  nused++;
+  block->magic = 0;
 
-         if( isFS(m_flag[i], kImatrix) )  nbytes += m_size[i] * sizeof(int);
-    else if( isFS(m_flag[i], kDmatrix) )  nbytes += m_size[i] * sizeof(double);
-    else                                  nbytes += m_size[i] * sizeof(ITEM);
-  }
+# ifdef MS_WIN
+  _aligned_free( block );
+# else
+  free( block );
+# endif
+}
 
 
-  char text[200];
+void MEMORY::Account( int nalloc, int nused, long nbytes )
+{
+# pragma omp critical (memory_stat)
+  {
+    m_nalloc += nalloc;
+    m_nused  += nused;
+    m_nbytes += nbytes;
 
-  sprintf( text, "\n %s %u %s\n %s %u arrays | %u in use\n",
-                 "(MEMORY)               ", nbytes,
-                 "bytes of memory allocated",
-                 "                       ", nalloc, nused );
-  REPORT::rpt.Output( text, 3 );
+    if( m_nalloc > m_peak_nalloc )  m_peak_nalloc = m_nalloc;
+    if( m_nused  > m_peak_nused  )  m_peak_nused  = m_nused;
+    if( m_nbytes > m_peak_nbytes )  m_peak_nbytes = m_nbytes;
+  }
 }
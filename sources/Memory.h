@@ -15,6 +15,12 @@
 //
 // This class implements functionality to allocate memory for 1D- and 2D-arrays.
 //
+// Scratch arrays are held in size classes (GRID::np, GRID::ne, EQS::neq and others).
+// Every array carries a small header, so that Detach() finds its block without a
+// search. Detached arrays are kept on free lists which are private to each thread
+// (_OPENMP), and new arrays are initialized by the allocating thread (first touch).
+// Large blocks may be backed by huge pages (define _HUGEPAGES in Defs.h).
+//
 // -------------------------------------------------------------------------------------------------
 //
 // COPYRIGHT (C) 2011 - 2014  by  P.M. SCHROEDER  (sc)
@@ -49,6 +55,7 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  18.09.2004    sc    first implementation / first concept
+//  19.10.2026    ag    arena with size classes, per-thread free lists and first touch
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,24 +88,65 @@ class MEMORY
       void*  v;
     };
 
-    int           m_array;
-
-    ITEM**        m_temp;     // teporary used arrays
-    unsigned int* m_size;     // size of arrays
-    unsigned int* m_flag;     // flag to mark arrays ...
     enum {
-      kUsed    =  1,          // ... in use
-      kDelete  =  2,          // ... can be deleted
+      kUsed    =  1,          // flag to mark arrays in use
       kNd      =  4,
       kEl      =  8,
       kEq      = 16,
       kImatrix = 32,          // ... 2-dimensional int array
       kDmatrix = 64           // ... 2-dimensional double array
     };
+
+    enum {
+      kClassNd,               // size classes
+      kClassEl,
+      kClassEq,
+      kClassAny,
+      kClasses
+    };
+
+    enum {
+      kAlign    = 64,         // alignment of arrays (cache line)
+      kHeader   = 64,         // size of block header in front of arrays
+      kMagic    = 0x4D454D4F, // tag to identify blocks of this class
+#   ifdef _OPENMP
+      kThreads  = 64          // maximum number of threads with private free lists;
+                              // further threads share one locked list
+#   else
+      kThreads  =  1
+#   endif
+    };
+
+    struct BLOCK              // header in front of each array
+    {
+      BLOCK*       next;      // next block in free list
+      size_t       bytes;     // allocated bytes including header
+      unsigned int size;      // number of items
+      unsigned int flag;
+      unsigned int magic;
+      int          thread;    // thread which allocated and touched the block
+    };
+
+    struct POOL               // free lists of one thread
+    {
+      BLOCK*       free[kClasses];
+      char         pad[kAlign];
+    };
+
+    POOL*         m_pool;
+
                               // maximum size of arrays ...
-    unsigned int m_max_nnd;   // length of list: GRID::np
-    unsigned int m_max_nel;   //                 GRID::ne
-    unsigned int m_max_neq;   //                 EQS::neq
+    unsigned int  m_max_nnd;  // length of list: GRID::np
+    unsigned int  m_max_nel;  //                 GRID::ne
+    unsigned int  m_max_neq;  //                 EQS::neq
+
+    size_t        m_nbytes;   // allocated bytes
+    unsigned int  m_nalloc;   // number of allocated arrays
+    unsigned int  m_nused;    // number of arrays in use
+
+    size_t        m_peak_nbytes;   // high-water marks
+    unsigned int  m_peak_nalloc;
+    unsigned int  m_peak_nused;
 
 
   // =====================================================================================
@@ -108,7 +156,7 @@ class MEMORY
   public:
     // -----------------------------------------------------------------------------------
     // constructor
-    MEMORY( int array =200 );
+    MEMORY();
 
     // -----------------------------------------------------------------------------------
     // destructor
@@ -138,7 +186,16 @@ class MEMORY
 
   // =====================================================================================
   private:
-    void     Delete( int i );
+    int      Thread();
+    BLOCK*   Take( int t, int cls, unsigned int n );
+    void     Put( int t, int cls, BLOCK* block );
+    int      Class( unsigned int flag );
+    unsigned int Size( int cls, unsigned int n );
+
+    BLOCK*   Block( void* ptr );
+    BLOCK*   Allocate( size_t bytes, unsigned int size, unsigned int flag );
+    void     Release( BLOCK* block );
+    void     Account( int nalloc, int nused, long nbytes );
 
   // =====================================================================================
   protected:
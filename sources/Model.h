@@ -68,6 +68,7 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1998    sc    first implementation / first concept
+//  19.10.2026    ag    dry/rewet restricted to the wet/dry line: DoDryRewet(..., front)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -165,7 +166,7 @@ class MODEL
     void    ContinuityBSL();
 
     // DoDryRew.cpp ------------------------------------------------------------------------
-    void    DoDryRewet( PROJECT* project, int* dried =NULL, int* wetted =NULL );
+    void    DoDryRewet( PROJECT* project, int* dried =NULL, int* wetted =NULL, int front =false );
     void    MPI_Comm_Dry( PROJECT* project, int initialize );
 
     // DoFriction.cpp ----------------------------------------------------------------------
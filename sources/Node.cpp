@@ -52,6 +52,7 @@ NODE::NODE()
 
   cf   = 0.0;
   cfw  = 0.0;
+  cw   = 0.0;
 
   vt   = 0.0;
   exx  = 0.0;
@@ -100,6 +101,7 @@ NODE NODE::operator =( const NODE& n )
   dz        = n.dz;
   cf        = n.cf;
   cfw       = n.cfw;
+  cw        = n.cw;
   vt        = n.vt;
   exx       = n.exx;
   exy       = n.exy;
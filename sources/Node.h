@@ -50,6 +50,7 @@
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1992    sc    first implementation / first concept
 //  01.09.2004    sc    class SUB implemented for parallel computing
+//  19.10.2026    ag    start value NODE::cw of Colebrook-White iteration
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -125,6 +126,7 @@ class NODE
 
     double cf;                          // bottom friction coefficient
     double cfw;                         // wall friction coefficient
+    double cw;                          // 1/sqrt(cf) of last Colebrook-White iteration
     double vt;                          // eddy viscosity
     double exx, exy, eyy;               // eddy diffusivity
     double uu, uv, vv;                  // Reynolds stresses
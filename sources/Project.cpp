@@ -61,6 +61,11 @@ PROJECT::PROJECT()
   lmm = NULL;
 
   errLevel = kErr_no_error;
+  adaptErr = kErr_no_error;
+  adaptZ   = NULL;
+  skipFlow = false;
+
+  iterCountNR = 0;
 
   nSection = 0;
 
@@ -72,6 +77,12 @@ PROJECT::PROJECT()
   convS  = 1.0e-4;
   convKD = 1.0e-4;
 
+  changeUV = -1.0;
+  changeS  = -1.0;
+
+  skipKD    = 0.0;
+  maxSkipKD = 10;
+
   dep_minVt   = 0.0;
   dep_minVtxx = 0.0;
   dep_minVtyy = 0.0;
@@ -91,6 +102,13 @@ PROJECT::PROJECT()
   maxDeltaS   = 0.1;
   maxDeltaKD  = 0.1;
 
+  predictor   = 0;
+  warmStart   = false;
+  relaxLocal  = 0.0;
+  jfnkLag     = 0;
+
+  contErr     = false;
+
   mueSf       = 1.0;
   maxTanSf    = 0.5;
   minUSf      = 0.01;
@@ -206,27 +224,35 @@ PROJECT::PROJECT()
     kSED_MAXDZ,       "SED_MAXDZ",          // 69
     kSED_EXNEREQ,     "SED_EXNEREQ",        // 70
     kSED_ZB_INIT,     "SED_ZB_INIT",        // 71
+    kSED_MORFAC,      "SED_MORFAC",         // 72
+    kSED_FRACTION,    "SED_FRACTION",       // 73
+    kSED_HIDING,      "SED_HIDING",         // 74
+
+    kCHANGELIMIT,     "CHANGELIMIT",        // 75
+    kKDSKIP,          "KDSKIP",             // 76
+    kDRAGTABLE,       "DRAGTABLE",          // 77
+    kCONTERR,         "CONTERR",            // 78
 
     // depreciated keys (recognized for compatibility reasons)
-    kMINMAX,          "MINMAX",             // 72
+    kMINMAX,          "MINMAX",             // 79
 
     // key with changed names (recognized for compatibility reasons)
-    kASC_INITFILE,    "ASC_INIFILE",        // 73
-    kBIN_INITFILE,    "BIN_INIFILE",        // 74
-    kSTA_INITFILE,    "STA_INIFILE",        // 75
-    kASC_RESTFILE,    "ASC_RESTARTFILE",    // 76
-    kBIN_RESTFILE,    "BIN_RESTARTFILE",    // 77
-    kSTA_RESTFILE,    "STA_OUTFILE",        // 78
-    kCN_UCDFILE,      "RED_UCDFILE",        // 79
-    kWN_UCDFILE,      "WET_UCDFILE",        // 80
-    kST_UCDFILE,      "STA_UCDFILE",        // 81
-
-    kRG_UCDFILE,      "GEO_UCDFILE",        // 82
-
-    kOUTPUTPATH,      "SUBDOMPATH",         // 83
-
-    kREPORTLEVEL,     "REPPORTLEVEL",       // 84
-    kREPORTFILE,      "REPPORTFILE"         // 85
+    kASC_INITFILE,    "ASC_INIFILE",        // 80
+    kBIN_INITFILE,    "BIN_INIFILE",        // 81
+    kSTA_INITFILE,    "STA_INIFILE",        // 82
+    kASC_RESTFILE,    "ASC_RESTARTFILE",    // 83
+    kBIN_RESTFILE,    "BIN_RESTARTFILE",    // 84
+    kSTA_RESTFILE,    "STA_OUTFILE",        // 85
+    kCN_UCDFILE,      "RED_UCDFILE",        // 86
+    kWN_UCDFILE,      "WET_UCDFILE",        // 87
+    kST_UCDFILE,      "STA_UCDFILE",        // 88
+
+    kRG_UCDFILE,      "GEO_UCDFILE",        // 89
+
+    kOUTPUTPATH,      "SUBDOMPATH",         // 90
+
+    kREPORTLEVEL,     "REPPORTLEVEL",       // 91
+    kREPORTFILE,      "REPPORTFILE"         // 92
  };
 
   nkey   = kSZ_RISKEY + 13;
@@ -327,6 +353,7 @@ PROJECT::PROJECT()
 
 PROJECT::~PROJECT()
 {
+  if( adaptZ )  delete[] adaptZ;
 }
 
 
@@ -898,12 +925,14 @@ void PROJECT::Input_00000( ASCIIFILE* file )
         break;
 
       case kBicgstab:
-        sscanf( textLine, "%d %d %d %d %d %d %lf",
+        sscanf( textLine, "%d %d %d %d %d %d %lf %d %lf",
                 &no, &type, &SOLVER::m_solver[i]->preconType,
                             &SOLVER::m_solver[i]->proceed,
                             &SOLVER::m_solver[i]->mceq,
                             &SOLVER::m_solver[i]->maxIter,
-                            &SOLVER::m_solver[i]->maxDiff );
+                            &SOLVER::m_solver[i]->maxDiff,
+                            &SOLVER::m_solver[i]->forcing,
+                            &SOLVER::m_solver[i]->maxEta );
 
         sprintf( text, "\n %d. %s\n",
                  i+1, "solver specification: BiCGStab" );
@@ -919,12 +948,14 @@ void PROJECT::Input_00000( ASCIIFILE* file )
         break;
 
       case kParmsBcgstabd:
-        sscanf( textLine, "%d %d %d %d %d %d %lf",
+        sscanf( textLine, "%d %d %d %d %d %d %lf %d %lf",
                 &no, &type, &SOLVER::m_solver[i]->preconType,
                             &SOLVER::m_solver[i]->proceed,
                             &SOLVER::m_solver[i]->mceq,
                             &SOLVER::m_solver[i]->maxIter,
-                            &SOLVER::m_solver[i]->maxDiff );
+                            &SOLVER::m_solver[i]->maxDiff,
+                            &SOLVER::m_solver[i]->forcing,
+                            &SOLVER::m_solver[i]->maxEta );
 
         sprintf( text, "\n %d. %s\n",
                  i+1, "solver specification: PARMS - BiCGStab" );
@@ -940,13 +971,15 @@ void PROJECT::Input_00000( ASCIIFILE* file )
         break;
 
       case kParmsFgmresd:
-        sscanf( textLine, "%d %d %d %d %d %d %d %lf",
+        sscanf( textLine, "%d %d %d %d %d %d %d %lf %d %lf",
                 &no, &type, &SOLVER::m_solver[i]->preconType,
                             &SOLVER::m_solver[i]->proceed,
                             &SOLVER::m_solver[i]->mceq,
                             &SOLVER::m_solver[i]->mkyrl,
                             &SOLVER::m_solver[i]->maxIter,
-                            &SOLVER::m_solver[i]->maxDiff );
+                            &SOLVER::m_solver[i]->maxDiff,
+                            &SOLVER::m_solver[i]->forcing,
+                            &SOLVER::m_solver[i]->maxEta );
 
         sprintf( text, "\n %d. %s\n",
                  i+1, "solver specification: PARMS - flexible Gmres" );
@@ -962,6 +995,14 @@ void PROJECT::Input_00000( ASCIIFILE* file )
         REPORT::rpt.Output( text, 4 );
         break;
     }
+
+    if( SOLVER::m_solver[i]->forcing )
+    {
+      sprintf( text, "  %30s  %d\n  %30s  %lf\n",
+               "forcing term:",      SOLVER::m_solver[i]->forcing,
+               "max. forcing term:", SOLVER::m_solver[i]->maxEta );
+      REPORT::rpt.Output( text, 4 );
+    }
   }
 
   REPORT::rpt.OutputLine1( 3 );
@@ -1059,14 +1100,22 @@ void PROJECT::Input_00000( ASCIIFILE* file )
   maxDeltaUV  = 0.01;
   maxDeltaS   = 0.1;
   maxDeltaKD  = 0.01;
+  predictor   = 0;
+  warmStart   = false;
+  relaxLocal  = 0.0;
+  jfnkLag     = 0;
 
   textLine = file->nextLine();
-  sscanf( textLine, " %d %lf %lf %lf %lf %lf", &(relaxMethod),
-                                               &(relaxMin),
-                                               &(relaxMax),
-                                               &(maxDeltaUV),
-                                               &(maxDeltaS),
-                                               &(maxDeltaKD) );
+  sscanf( textLine, " %d %lf %lf %lf %lf %lf %d %d %lf %d", &(relaxMethod),
+                                                         &(relaxMin),
+                                                         &(relaxMax),
+                                                         &(maxDeltaUV),
+                                                         &(maxDeltaS),
+                                                         &(maxDeltaKD),
+                                                         &(predictor),
+                                                         &(warmStart),
+                                                         &(relaxLocal),
+                                                         &(jfnkLag) );
 
   sprintf( text, "  %30s  %d\n  %30s  %9.6lf\n  %30s  %9.6lf\n\n",
                  "relaxation...  method:",  relaxMethod,
@@ -1080,6 +1129,24 @@ void PROJECT::Input_00000( ASCIIFILE* file )
                  "     max change of KD:",  maxDeltaKD );
   REPORT::rpt.Output( text, 3 );
 
+  sprintf( text, "  %30s  %4d\n  %30s  %4d\n\n",
+                 "order of predictor:",       predictor,
+                 "warm start of solver:",     warmStart );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %9.2lf\n\n",
+                 "max. ratio of local time:", relaxLocal );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %4d\n\n",
+                 "Jacobian-free NK (lag):",   jfnkLag );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %9.6lf\n  %30s  %4d\n\n",
+                 "skip KD cycles... limit:",  skipKD,
+                 "              maximum:",    maxSkipKD );
+  REPORT::rpt.Output( text, 3 );
+
   REPORT::rpt.OutputLine1( 3 );
 
 
@@ -1088,20 +1155,24 @@ void PROJECT::Input_00000( ASCIIFILE* file )
   DRYREW* dryRew = &M2D->region->dryRew;
 
   textLine = file->nextLine();
-  sscanf( textLine, " %d %d %lf %lf %d %d", &(dryRew->method),
+  sscanf( textLine, " %d %d %lf %lf %d %d %d %d", &(dryRew->method),
           &(dryRew->dryRewFreq),
           &(dryRew->dryLimit),
           &(dryRew->rewetLimit),
           &(dryRew->rewetPasses),
-          &(dryRew->countDown) );
+          &(dryRew->countDown),
+          &(dryRew->frontFreq),
+          &(dryRew->stableEqno) );
 
   if( dryRew->rewetLimit < dryRew->dryLimit ) dryRew->rewetLimit = dryRew->dryLimit;
 
-  sprintf( text, "  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n\n",
+  sprintf( text, "  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n\n",
                  "dry/rewet method:",         dryRew->method,
                  "frequency of dry/rewet:",   dryRew->dryRewFreq,
                  "number of rewet passes:",   dryRew->rewetPasses,
-                 "count down for rewetting:", dryRew->countDown );
+                 "count down for rewetting:", dryRew->countDown,
+                 "frequency on wet/dry line:", dryRew->frontFreq,
+                 "stable equation numbers:",  dryRew->stableEqno );
   REPORT::rpt.Output( text, 3 );
 
   sprintf( text, "  %30s  %9.6lf\n  %30s  %9.6lf\n\n",
@@ -1297,6 +1368,8 @@ void PROJECT::Input_30900( ASCIIFILE* file )
   int   _minVtKD = false;
   int   _minVtC  = false;
 
+  int   frac     = 0;               // fraction number of sediment keys (not used)
+
   outputPath[0] = '\0';
 
   while( !feof(file->getid()) )
@@ -1731,31 +1804,37 @@ void PROJECT::Input_30900( ASCIIFILE* file )
               break;
 
             case kBicgstab:
-              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %lf",
+              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %lf %d %lf",
                       &no, &type, &SOLVER::m_solver[SOLVER::m_neqs]->preconType,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->proceed,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->mceq,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->maxIter,
-                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff );
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->forcing,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxEta );
               break;
 
             case kParmsBcgstabd:
-              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %lf",
+              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %lf %d %lf",
                       &no, &type, &SOLVER::m_solver[SOLVER::m_neqs]->preconType,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->proceed,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->mceq,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->maxIter,
-                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff );
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->forcing,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxEta );
               break;
 
             case kParmsFgmresd:
-              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %d %lf",
+              sscanf( textLine, "$SOLVER %d %d %d %d %d %d %d %lf %d %lf",
                       &no, &type, &SOLVER::m_solver[SOLVER::m_neqs]->preconType,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->proceed,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->mceq,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->mkyrl,
                                   &SOLVER::m_solver[SOLVER::m_neqs]->maxIter,
-                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff );
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxDiff,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->forcing,
+                                  &SOLVER::m_solver[SOLVER::m_neqs]->maxEta );
               break;
           }
 
@@ -1769,6 +1848,23 @@ void PROJECT::Input_30900( ASCIIFILE* file )
                           &convUV, &convS, &convKD, &sed.convQb );
         break;
 
+      // ---------------------------------------------------------------------------------
+      case kCHANGELIMIT:
+        sscanf( textLine, "$CHANGELIMIT %lf %lf", &changeUV, &changeS );
+        break;
+
+      case kKDSKIP:
+        sscanf( textLine, "$KDSKIP %lf %d", &skipKD, &maxSkipKD );
+        break;
+
+      case kDRAGTABLE:
+        sscanf( textLine, "$DRAGTABLE %lf", &TYPE::dragTol );
+        break;
+
+      case kCONTERR:
+        sscanf( textLine, "$CONTERR %d", &contErr );
+        break;
+
       // ---------------------------------------------------------------------------------
       case kMINMAX:
         sscanf( textLine, "$MINMAX %lf %lf %lf %lf %lf",
@@ -1819,24 +1915,30 @@ void PROJECT::Input_30900( ASCIIFILE* file )
 
       // ---------------------------------------------------------------------------------
       case kRELAX:
-        sscanf( textLine, "$RELAX %d %lf %lf %lf %lf %lf", &relaxMethod,
-                                                           &relaxMin,
-                                                           &relaxMax,
-                                                           &maxDeltaUV,
-                                                           &maxDeltaS,
-                                                           &maxDeltaKD );
+        sscanf( textLine, "$RELAX %d %lf %lf %lf %lf %lf %d %d %lf %d", &relaxMethod,
+                                                                     &relaxMin,
+                                                                     &relaxMax,
+                                                                     &maxDeltaUV,
+                                                                     &maxDeltaS,
+                                                                     &maxDeltaKD,
+                                                                     &predictor,
+                                                                     &warmStart,
+                                                                     &relaxLocal,
+                                                                     &jfnkLag );
         break;
 
       // ---------------------------------------------------------------------------------
       case kDRYREW:
         {
           DRYREW* dryRew = &M2D->region->dryRew;
-          sscanf( textLine, "$DRYREW %d %d %lf %lf %d %d", &dryRew->method,
-                                                           &dryRew->dryRewFreq,
-                                                           &dryRew->dryLimit,
-                                                           &dryRew->rewetLimit,
-                                                           &dryRew->rewetPasses,
-                                                           &dryRew->countDown );
+          sscanf( textLine, "$DRYREW %d %d %lf %lf %d %d %d %d", &dryRew->method,
+                                                              &dryRew->dryRewFreq,
+                                                              &dryRew->dryLimit,
+                                                              &dryRew->rewetLimit,
+                                                              &dryRew->rewetPasses,
+                                                              &dryRew->countDown,
+                                                              &dryRew->frontFreq,
+                                                              &dryRew->stableEqno );
           if( dryRew->rewetLimit < dryRew->dryLimit ) dryRew->rewetLimit = dryRew->dryLimit;
         }
         break;
@@ -1912,44 +2014,44 @@ void PROJECT::Input_30900( ASCIIFILE* file )
 
       // ---------------------------------------------------------------------------------
       case kSED_RHOB:
-        sscanf( textLine, "$SED_RHOB %d %lf", &sed.nfrac, &sed.rhob );
+        sscanf( textLine, "$SED_RHOB %d %lf", &frac, &sed.rhob );
         break;
 
       case kSED_M:
-        sscanf( textLine, "$SED_M %d %lf", &sed.nfrac, &sed.M );
+        sscanf( textLine, "$SED_M %d %lf", &frac, &sed.M );
         break;
 
       case kSED_TAUC:
-        sscanf( textLine, "$SED_TAUC %d %lf", &sed.nfrac, &sed.tauc );
+        sscanf( textLine, "$SED_TAUC %d %lf", &frac, &sed.tauc );
         break;
 
       case kSED_TAUS:
-        sscanf( textLine, "$SED_TAUS %d %lf", &sed.nfrac, &sed.taus );
+        sscanf( textLine, "$SED_TAUS %d %lf", &frac, &sed.taus );
         break;
 
       case kSED_US:
-        sscanf( textLine, "$SED_US %d %lf", &sed.nfrac, &sed.us );
+        sscanf( textLine, "$SED_US %d %lf", &frac, &sed.us );
         break;
 
       case kSED_D50:
-        sscanf( textLine, "$SED_D50 %d %lf", &sed.nfrac, &sed.d50 );
+        sscanf( textLine, "$SED_D50 %d %lf", &frac, &sed.d50 );
         break;
 
       case kSED_D90:
-        sscanf( textLine, "$SED_D90 %d %lf", &sed.nfrac, &sed.d90 );
+        sscanf( textLine, "$SED_D90 %d %lf", &frac, &sed.d90 );
         break;
 
       case kSED_POR:
-        sscanf( textLine, "$SED_POR %d %lf", &sed.nfrac, &sed.por );
+        sscanf( textLine, "$SED_POR %d %lf", &frac, &sed.por );
         break;
 
       case kSED_PHIR:
-        sscanf( textLine, "$SED_PHIR %d %lf", &sed.nfrac, &sed.phir );
+        sscanf( textLine, "$SED_PHIR %d %lf", &frac, &sed.phir );
         sed.phir = tan( sed.phir * PI/180.0 );
         break;
 
       case kSED_LOADEQ:
-        sscanf( textLine, "$SED_LOADEQ %d", &sed.loadeq );
+        sscanf( textLine, "$SED_LOADEQ %d %d", &sed.loadeq, &sed.fastMath );
         break;
 
       case kSED_LS:
@@ -1980,6 +2082,38 @@ void PROJECT::Input_30900( ASCIIFILE* file )
         sscanf( textLine, "$SED_ZB_INIT %d", &sed.zb_init );
         break;
 
+      case kSED_MORFAC:
+        sscanf( textLine, "$SED_MORFAC %lf %d %lf", &sed.morFac,
+                          &sed.subSteps, &sed.skipFlow );
+        if( sed.morFac <= 0.0 )  sed.morFac   = 1.0;
+        if( sed.subSteps < 1 )   sed.subSteps = 1;
+        break;
+
+      case kSED_FRACTION:
+        {
+          int    k  = 0;
+          double dk = 0.0;
+          double pk = 0.0;
+
+          sscanf( textLine, "$SED_FRACTION %d %lf %lf", &k, &dk, &pk );
+
+          if( k < 1  ||  k > SED::kMaxFrac  ||  dk <= 0.0  ||  pk < 0.0 )
+          {
+            REPORT::rpt.Error( kParameterFault, "%s %d - PROJECT::Input_30900(1)",
+                               "invalid grain fraction", k );
+          }
+
+          sed.dk[k-1] = dk;
+          sed.pk[k-1] = pk;
+
+          if( k > sed.nfrac )  sed.nfrac = k;
+        }
+        break;
+
+      case kSED_HIDING:
+        sscanf( textLine, "$SED_HIDING %lf %lf", &sed.hiding, &sed.La );
+        break;
+
       // ---------------------------------------------------------------------------------
       case kSCALE:
         {
@@ -2203,6 +2337,14 @@ void PROJECT::Input_30900( ASCIIFILE* file )
         REPORT::rpt.Output( text, 4 );
         break;
     }
+
+    if( SOLVER::m_solver[i]->forcing )
+    {
+      sprintf( text, "  %30s  %d\n  %30s  %lf\n",
+               "forcing term:",      SOLVER::m_solver[i]->forcing,
+               "max. forcing term:", SOLVER::m_solver[i]->maxEta );
+      REPORT::rpt.Output( text, 4 );
+    }
   }
 
   REPORT::rpt.OutputLine1( 4 );
@@ -2375,6 +2517,24 @@ void PROJECT::Input_30900( ASCIIFILE* file )
                  "     max change of S :",  maxDeltaS,
                  "     max change of KD:",  maxDeltaKD );
   REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %4d\n  %30s  %4d\n\n",
+                 "order of predictor:",       predictor,
+                 "warm start of solver:",     warmStart );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %9.2lf\n\n",
+                 "max. ratio of local time:", relaxLocal );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %4d\n\n",
+                 "Jacobian-free NK (lag):",   jfnkLag );
+  REPORT::rpt.Output( text, 3 );
+
+  sprintf( text, "  %30s  %9.6lf\n  %30s  %4d\n\n",
+                 "skip KD cycles... limit:",  skipKD,
+                 "              maximum:",    maxSkipKD );
+  REPORT::rpt.Output( text, 3 );
   REPORT::rpt.OutputLine1( 3 );
 
 
@@ -2382,11 +2542,13 @@ void PROJECT::Input_30900( ASCIIFILE* file )
 
   DRYREW* dryRew = &M2D->region->dryRew;
 
-  sprintf( text, "  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n\n",
+  sprintf( text, "  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n  %30s  %4d\n\n",
                  "dry/rewet method:",         dryRew->method,
                  "frequency of dry/rewet:",   dryRew->dryRewFreq,
                  "number of rewet passes:",   dryRew->rewetPasses,
-                 "count down for rewetting:", dryRew->countDown );
+                 "count down for rewetting:", dryRew->countDown,
+                 "frequency on wet/dry line:", dryRew->frontFreq,
+                 "stable equation numbers:",  dryRew->stableEqno );
   REPORT::rpt.Output( text, 3 );
 
   sprintf( text, "  %30s  %9.6lf\n  %30s  %9.6lf\n\n",
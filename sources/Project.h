@@ -11,7 +11,14 @@
 //
 // Compute.cpp : method  PROJECT::Compute()
 // Cycle.cpp   : methods PROJECT::NextCycle()
+//                       PROJECT::PeekCycle()
 //                       PROJECT::PrintTheCycle()
+//                       PROJECT::CycleData()
+//                       PROJECT::Overlap()
+//                       PROJECT::SkipCycle()
+// Adapt.cpp   : methods PROJECT::AdaptStart()
+//                       PROJECT::AdaptReject()
+//                       PROJECT::AdaptNext()
 //
 // -------------------------------------------------------------------------------------------------
 //
@@ -56,6 +63,24 @@
 //  13.10.2011    sc    cycles "..._dt" + "..._tr" removed, stationary flow computation
 //                      will be established by the key $STATIONARY im the tmiestep-file
 //  28.10.2011    sc    cleaning up keys structure (RISKEY)
+//  19.10.2026    ag    key $CHANGELIMIT: limits of nodal changes to recompute friction and
+//                      eddy viscosity (changeUV, changeS)
+//  19.10.2026    ag    predictor and warmStart: predictor of U,V,S and warm start of the
+//                      iterative solver in the UVS Newton iteration
+//  19.10.2026    ag    adaptive sub steps (AdaptStart, AdaptReject, AdaptNext); Newton
+//                      iterations of the last flow cycle (iterCountNR)
+//  19.10.2026    ag    relaxLocal: local pseudo time steps in time relaxed stationary flow
+//  19.10.2026    ag    jfnkLag: Jacobian-free Newton-Krylov iterations for UVS
+//  19.10.2026    ag    data read and written by cycles (DATA, CycleData); sediment parameters
+//                      of the next cycle computed concurrently (PeekCycle, Overlap, OpenMP)
+//  19.10.2026    ag    key $SED_MORFAC; flow cycles skipped for small bed changes (skipFlow,
+//                      SkipCycle)
+//  19.10.2026    ag    keys $SED_FRACTION and $SED_HIDING: grain fractions of bed load
+//  19.10.2026    ag    key $KDSKIP: k-epsilon cycles skipped in stationary flow (skipKD,
+//                      maxSkipKD)
+//  19.10.2026    ag    changeS < 0: friction and eddy viscosity recomputed at all nodes
+//  19.10.2026    ag    key $DRAGTABLE: optional drag table of non-submerged vegetation
+//  19.10.2026    ag    key $CONTERR: report of continuity errors of elements
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -341,6 +366,9 @@ class PROJECT
       kSED_US,           kSED_D50,          kSED_D90,          kSED_POR,
       kSED_PHIR,         kSED_LOADEQ,       kSED_LS,           kSED_SLOPE,
       kSED_MINQB,        kSED_MAXDZ,        kSED_EXNEREQ,      kSED_ZB_INIT,
+      kSED_MORFAC,       kSED_FRACTION,     kSED_HIDING,
+
+      kCHANGELIMIT,      kKDSKIP,           kDRAGTABLE,        kCONTERR,
 
       // deprecated keys
       kMINMAX,
@@ -362,6 +390,22 @@ class PROJECT
       kFLDRATE, kKINRATIO, kSZ_VARS
     };
 
+    // data read and written by cycles (CycleData, Overlap) ----------------------------
+    enum DATA
+    {
+      kDataUVS  = 0x0001,     // U, V, S and time derivatives
+      kDataKD   = 0x0002,     // K, D and boundary conditions for K and D
+      kDataVt   = 0x0004,     // friction, eddy viscosity and Reynolds stresses
+      kDataDisp = 0x0008,     // dispersion coefficients and secondary flow
+      kDataQb   = 0x0010,     // bed load
+      kDataC    = 0x0020,     // suspended load
+      kDataZ    = 0x0040,     // bottom elevation
+      kDataWet  = 0x0080,     // dry/wet state and model structure
+      kDataSed  = 0x0100,     // sediment parameters (SED::Initialize)
+      kDataOut  = 0x0200,     // output files
+      kDataAll  = 0xffff
+    };
+
     int     nval;
     VALIST* valist;
 
@@ -419,6 +463,9 @@ public:
     EQS_UVS2D_TMAI eqs_uvs2d_tmai;      // equation system for shallow water flow
 
     int            errLevel;
+    int            adaptErr;            // error level saved at begin of adaptive sub step
+    double*        adaptZ;              // bottom elevation saved at begin of sub step
+    int            skipFlow;            // skip flow cycles in actual time step
 
     // ----------------------------------- arrays ----------------------------------------
     double*  lmm;                       // lumped mass matrix
@@ -446,6 +493,9 @@ public:
     double   convS;
     double   convKD;
 
+    double   changeUV;                  // limits of nodal changes to recompute
+    double   changeS;                   // friction and eddy viscosity (< 0: off)
+
     int      relaxMethod;               // relaxation method (1 or 2)
     double   relaxMin,                  // minimum relaxation parameter  (< 1.0)
              relaxMax,                  // maximum relaxation parameter  (= 1.0)
@@ -453,6 +503,20 @@ public:
              maxDeltaS,                 // maximum allowed change of water elevation
              maxDeltaKD;                // maximum allowed changes of K and D
 
+    int      predictor;                 // order of the predictor for U,V,S (0, 1 or 2)
+    int      warmStart;                 // previous Newton correction as initial guess
+    double   relaxLocal;                // max. ratio of local to global pseudo time step
+    int      jfnkLag;                   // Jacobian-free Newton-Krylov for UVS: number of
+                                        // iterations with the same preconditioner (0: off)
+
+    int      iterCountNR;               // Newton iterations of last unsteady flow cycle
+
+    double   skipKD;                    // k-epsilon cycles in stationary flow are skipped,
+    int      maxSkipKD;                 // if K, D and velocity gradients changed less than
+                                        // skipKD (0: off); at most maxSkipKD cycles in a row
+
+    int      contErr;                   // report continuity errors of elements (UVS)
+
     int      smoothPassesBC;            // number of smoothing passes for bc.
     int      smoothPassesKD;            // number of smoothing passes for KD
     int      smoothPassesVT;            // number of smoothing passes for vt
@@ -571,7 +635,16 @@ public:
 
     // Cycle.cpp -------------------------------------------------------------------------
     int     NextCycle( BCONSET*, int );
+    int     PeekCycle( BCONSET* );
+    int     SkipCycle( int cycle );
     void    PrintTheCycle( int );
+    void    CycleData( int cycle, int* read, int* write );
+    int     Overlap( int cycle, int next );
+
+    // Adapt.cpp -------------------------------------------------------------------------
+    void    AdaptStart();
+    int     AdaptReject();
+    void    AdaptNext();
 };
 
 #endif
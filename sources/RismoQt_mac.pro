@@ -66,6 +66,10 @@ SOURCES += \
     Frontm.cpp \
     Front.cpp \
     Fromat.cpp \
+    Changes.cpp \
+    Geom.cpp \
+    Bucket.cpp \
+    Adapt.cpp \
     Friction.cpp \
     EqsUVS2D_LV.cpp \
     EqsUVS2D.cpp \
@@ -149,6 +153,9 @@ HEADERS += \
     Frontm.h \
     Front.h \
     Fromat.h \
+    Changes.h \
+    Geom.h \
+    Bucket.h \
     EqsUVS2D_LV.h \
     EqsUVS2D.h \
     EqsSL2D.h \
@@ -36,6 +36,8 @@
 
 #include "Section.h"
 
+#define kSectEpsilon  1.0e-3     // tolerance of interpolate()
+
 
 SECTION::SECTION()
 {
@@ -101,7 +103,7 @@ int SECTION::interpolate( SECTION* next,
                           double   y,
                           double*  z )
 {
-  double epsilon = 1.0e-3;
+  double epsilon = kSectEpsilon;
 
   // check if coordinate (x,y) is inside of the quadrilateral
   // built of sections "this" and "next", and interpolate z
@@ -132,6 +134,86 @@ int SECTION::interpolate( SECTION* next,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Determine the bounding box of all points (x,y), for which interpolate() succeeds with
+// the sections "this" and "next". This is possible for a convex quadrilateral only,
+// which contains its centre: the tolerance kSectEpsilon widens the quadrilateral at
+// each corner by kSectEpsilon / sin(alpha/2), where alpha is the interior angle.
+// Returns 0, if no bounding box was determined.
+
+int SECTION::strip( SECTION* next,
+                    double*  xmin,
+                    double*  ymin,
+                    double*  xmax,
+                    double*  ymax )
+{
+  double px[4] = { this->xs, this->xe, next->xe, next->xs };
+  double py[4] = { this->ys, this->ye, next->ye, next->ys };
+
+  // the centre has to be inside of the quadrilateral -----------------------------------
+  double xc = 0.25 * (px[0] + px[1] + px[2] + px[3]);
+  double yc = 0.25 * (py[0] + py[1] + py[2] + py[3]);
+  double zc;
+
+  if( !interpolate(next, xc, yc, &zc) )  return 0;
+
+  // check convexity and determine the smallest sine of half interior angles ------------
+  int    sign = 0;
+  double smin = 1.0;
+
+  for( int k=0; k<4; k++ )
+  {
+    int a = k;
+    int b = (k+1) % 4;
+    int c = (k+2) % 4;
+
+    double e1x = px[b] - px[a];
+    double e1y = py[b] - py[a];
+    double e2x = px[c] - px[b];
+    double e2y = py[c] - py[b];
+
+    double l1 = sqrt( e1x*e1x + e1y*e1y );
+    double l2 = sqrt( e2x*e2x + e2y*e2y );
+
+    if( l1 < 1.0e-6  ||  l2 < 1.0e-6 )  return 0;
+
+    double cross = e1x*e2y - e1y*e2x;
+
+    if( sign == 0 )  sign = (cross > 0.0)?  1 : -1;
+
+    if( cross * sign <= 0.0 )  return 0;
+
+    double cosa = -(e1x*e2x + e1y*e2y) / l1 / l2;
+    double sina = sqrt( 0.5 * (1.0 - cosa) );
+
+    if( sina < smin )  smin = sina;
+  }
+
+  if( smin < 1.0e-3 )  return 0;
+
+  // bounding box widened by the tolerance ----------------------------------------------
+  double margin = 2.0 * kSectEpsilon / smin;
+
+  *xmin = *xmax = px[0];
+  *ymin = *ymax = py[0];
+
+  for( int k=1; k<4; k++ )
+  {
+    if( px[k] < *xmin )  *xmin = px[k];
+    if( px[k] > *xmax )  *xmax = px[k];
+    if( py[k] < *ymin )  *ymin = py[k];
+    if( py[k] > *ymax )  *ymax = py[k];
+  }
+
+  *xmin -= margin;
+  *ymin -= margin;
+  *xmax += margin;
+  *ymax += margin;
+
+  return 1;
+}
+
+
 void SECTION::scaleFR( double lScale, double hScale )
 {
   this->xs /= lScale;
@@ -49,6 +49,7 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1998    sc    first implementation / first concept
+//  19.10.2026    ag    bounding box of the strip between sections: strip()
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -85,6 +86,7 @@ class SECTION
     double normalDistance( double, double );
     double tangentialDistance( double, double );
     int    interpolate( SECTION*, double, double, double* );
+    int    strip( SECTION*, double*, double*, double*, double* );
 
     void   scaleFR( double, double );
 };
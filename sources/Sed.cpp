@@ -44,6 +44,60 @@
 #include "Project.h"
 
 
+// ---------------------------------------------------------------------------------------
+// approximations of log() and exp() without calls to the math library, which may be
+// vectorized by the compiler (SED::fastMath); maximum relative error of FastLog() and of
+// FastExp( y*FastLog(x) ) for pow(x,y) is 5.0e-14 (exp() 1.0e-15), valid for normalized
+// positive arguments x and |y*log(x)| < 700
+// ---------------------------------------------------------------------------------------
+
+static inline double FastLog( double x )
+{
+  unsigned long long bits;
+  memcpy( &bits, &x, sizeof(double) );
+
+  // x = m * 2^e  with  sqrt(0.5) < m <= sqrt(2) -----------------------------------------
+  int e = (int)( (bits >> 52) & 0x7ff ) - 1023;
+  bits  = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+
+  double m;
+  memcpy( &m, &bits, sizeof(double) );
+
+  if( m > 1.4142135623730951 )
+  {
+    m *= 0.5;
+    e++;
+  }
+
+  // log(m) = 2 * atanh(s) = 2 * (s + s^3/3 + s^5/5 + ...)  with  s = (m-1)/(m+1) --------
+  double s  = (m - 1.0) / (m + 1.0);
+  double s2 = s * s;
+  double p  = s2*(1.0/3.0 + s2*(1.0/5.0 + s2*(1.0/7.0 + s2*(1.0/9.0
+              + s2*(1.0/11.0 + s2*(1.0/13.0 + s2*(1.0/15.0)))))));
+
+  return e * 0.6931471805599453  +  2.0*s  +  2.0*s*p;
+}
+
+
+static inline double FastExp( double x )
+{
+  // exp(x) = 2^k * exp(r)  with  |r| <= log(2)/2 ----------------------------------------
+  double k = floor( x * 1.4426950408889634 + 0.5 );
+  double r = (x - k * 0.693145751953125) - k * 1.4286068203094172e-6;
+
+  double p = 1.0 + r*(1.0 + r*(1.0/2.0 + r*(1.0/6.0 + r*(1.0/24.0 + r*(1.0/120.0
+             + r*(1.0/720.0 + r*(1.0/5040.0 + r*(1.0/40320.0 + r*(1.0/362880.0
+             + r*(1.0/3628800.0 + r*(1.0/39916800.0 + r*(1.0/479001600.0))))))))))));
+
+  unsigned long long bits = (unsigned long long)( (long long)k + 1023 ) << 52;
+
+  double f;
+  memcpy( &f, &bits, sizeof(double) );
+
+  return p * f;
+}
+
+
 // ---------------------------------------------------------------------------------------
 // method to initialize sediment parameters as qbe, Ls, sx, sy, ...
 // ---------------------------------------------------------------------------------------
@@ -61,6 +115,18 @@ void SED::Initialize( PROJECT* project )
   qbc = (double*) MEMORY::memo.Array_nd( rgnp );
   for( int n=0; n<rgnp; n++ )  qbc[n]  = 0.0;
 
+  // transport of grain fractions and composition of the active layer -------------------
+  if( nfrac > 1 )
+  {
+    InitFrac( rgnp );
+
+    for( int k=0; k<nfrac; k++ )
+    {
+      qbk[k] = (double*) MEMORY::memo.Array_nd( rgnp );
+      for( int n=0; n<rgnp; n++ )  qbk[k][n] = 0.0;
+    }
+  }
+
   if( lsType > 1 )
   {
     PLs = (double*) MEMORY::memo.Array_nd( rgnp );
@@ -97,6 +163,12 @@ void SED::Detach()
   if( dzmx )  MEMORY::memo.Detach( dzmx );
   if( dhds )  MEMORY::memo.Detach( dhds );
 
+  for( int k=0; k<kMaxFrac; k++ )
+  {
+    if( qbk[k] )  MEMORY::memo.Detach( qbk[k] );
+    qbk[k] = NULL;
+  }
+
   qbc  = NULL;
   PLs  = NULL;
   sx   = NULL;
@@ -705,24 +777,44 @@ void SED::Capacity( PROJECT* project,
 {
   GRID* rg = model->region;
   int   np = rg->Getnp();
-  int   ne = rg->Getne();
+
+  // arrays for a block of nodes ---------------------------------------------------------
+  int    no[kBlock];
+  double Us[kBlock], H[kBlock], Sz[kBlock], Sh[kBlock], Qb[kBlock], Ls[kBlock];
 
   // determine equilibrium transport -----------------------------------------------------
-  for( int n=0; n<np; n++ )
+  for( int n0=0; n0<np; n0+=kBlock )
   {
-    NODE* nd = rg->Getnode(n);
-    int   no = nd->Getno();
+    int nb = np - n0;
+    if( nb > kBlock )  nb = kBlock;
 
-    // determine scalar velocity, flow direction and bed slope ---------------------------
-    double U  = nd->v.U;
-    double V  = nd->v.V;
-    double H  = nd->v.S - nd->z;
+    // determine scalar velocity, flow depth and bed slope -------------------------------
+    for( int i=0; i<nb; i++ )
+    {
+      NODE* nd = rg->Getnode(n0+i);
 
-    double Us = sqrt( U*U + V*V );
+      no[i] = nd->Getno();
+
+      double U = nd->v.U;
+      double V = nd->v.V;
+
+      Us[i] = sqrt( U*U + V*V );
+      H[i]  = nd->v.S - nd->z;
+      Sz[i] = dzds[no[i]];
+      Sh[i] = dhds[no[i]];
+    }
 
-    qbc[no] = Equilib( Us, H, dzds[no], dhds[no], project );
+    if( nfrac > 1 )  EquilibFrac( nb, no, Us, H, Sz, Sh, Qb, project );
+    else             Equilib( nb, Us, H, Sz, Sh, Qb, project );
 
-    if( PLs )  PLs[no] = 1.0 / GetLs( Us, H, project );
+    for( int i=0; i<nb; i++ )  qbc[no[i]] = Qb[i];
+
+    if( PLs )
+    {
+      GetLs( nb, Us, H, Ls, project );
+
+      for( int i=0; i<nb; i++ )  PLs[no[i]] = 1.0 / Ls[i];
+    }
   }
 
   char text[200];
@@ -743,6 +835,9 @@ void SED::Bcon( PROJECT* project, MODEL* model )
   GRID* rg = model->region;
   int   np = rg->Getnp();
 
+  // the capacity of grain fractions is determined in Capacity() for all nodes ---------
+  if( nfrac > 1 )  return;
+
   for( int n=0; n<np; n++ )
   {
     NODE* nd = rg->Getnode(n);
@@ -827,6 +922,44 @@ double SED::Equilib( double   Us,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Equilib: equilibrium bed load for n nodes (the same as SED::Equilib() per node)
+// ---------------------------------------------------------------------------------------
+
+void SED::Equilib( int      n,
+                   double*  Us,
+                   double*  H,
+                   double*  dzds,
+                   double*  dhds,
+                   double*  qbe,
+                   PROJECT* project )
+{
+  switch( loadeq )
+  {
+    case 1:                   // note: SED::Equilib() falls through to case 2 and 3
+    case 2:
+    case 3:
+      Meyerpm( n, Us, H, dzds, dhds, qbe, project );
+      break;
+
+    default:
+      for( int i=0; i<n; i++ )  qbe[i] = 0.0;
+      break;
+  }
+
+  if( isFS(slope, kSLOPE_Qbe) )                    // gravitation effect by WANG (1998)
+  {
+    for( int i=0; i<n; i++ )
+    {
+      double f = 1.0 - alfaSlope * dzds[i];
+
+      if( f >= 0.0 )  qbe[i] *= f;
+      else            qbe[i]  = 0.0;
+    }
+  }
+}
+
+
 // ---------------------------------------------------------------------------------------
 // Meyerpm: formula of Meyer-Peter and Mueller
 // ---------------------------------------------------------------------------------------
@@ -875,6 +1008,283 @@ double SED::Meyerpm( double   Us,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Meyerpm: formula of Meyer-Peter and Mueller for n nodes; the parameters of the grain
+//          are determined once, the critical Shields parameter is corrected per node
+// ---------------------------------------------------------------------------------------
+
+void SED::Meyerpm( int      n,
+                   double*  Us,
+                   double*  H,
+                   double*  dzds,
+                   double*  dhds,
+                   double*  qbe,
+                   PROJECT* project )
+{
+  double g    = project->g;
+  double rho  = project->rho;
+  double vk   = project->vk;
+
+  double rr   = rhob/rho - 1.0;
+
+  // -------------------------------------------------------------------------------------
+
+  double Dst     = 0.0;       // particle diameter parameter
+  double thetacr = 0.0;
+  int    koch    = false;     // slope correction of thetacr (Shields_crit)
+
+  if( loadeq == 2 )
+  {
+    thetacr = 0.047;
+  }
+  else
+  {
+    Dst     = d50 * pow( rr*g/vk/vk, 0.3333 );
+    thetacr = Shields_crit( Dst, 0.0 );          // thetacr >= 0.03 without slope
+    koch    = phir > 0.001  &&  isFS(slope,kSLOPE_Shields);
+  }
+
+  // -------------------------------------------------------------------------------------
+
+  double Ubseff[kBlock];
+
+  GetUtau( n, Us, H, dhds, Ubseff, project );
+
+  for( int i=0; i<n; i++ )
+  {
+    double thcr = thetacr;
+
+    if( koch )                                    // KOCH, 1980
+    {
+      thcr *= 1.0 + dzds[i]/phir;
+      if( thcr < 0.01 )  thcr = 0.01;
+    }
+
+    double theta = Ubseff[i]*Ubseff[i] / rr / g / d50;
+
+    qbe[i] = 0.0;
+
+    if( theta > thcr )
+    {
+      double x = 1.0 - thcr/theta;
+
+      if( fastMath )  qbe[i] = 8.0 * Ubseff[i] * d50 * theta * (x * sqrt(x));
+      else            qbe[i] = 8.0 * Ubseff[i] * d50 * theta * pow( x, 1.5 );
+    }
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// EquilibFrac: equilibrium bed load of grain fractions for n nodes no[] (SED::qbk) and
+//              the total load qbe; the capacity of a fraction (MEYER-PETER and MUELLER)
+//              is weighted with its portion in the active layer and the critical Shields
+//              parameter is corrected for hiding and exposure (EGIAZAROFF type)
+//                   thetacr,k = thetacr(dk) * (dk/dm)^(-hiding)
+//              dm = mean grain diameter of the active layer
+// ---------------------------------------------------------------------------------------
+
+void SED::EquilibFrac( int      n,
+                       int*     no,
+                       double*  Us,
+                       double*  H,
+                       double*  dzds,
+                       double*  dhds,
+                       double*  qbe,
+                       PROJECT* project )
+{
+  double g    = project->g;
+  double rho  = project->rho;
+  double vk   = project->vk;
+
+  double rr   = rhob/rho - 1.0;
+
+  for( int i=0; i<n; i++ )  qbe[i] = 0.0;
+
+  if( loadeq < 1  ||  loadeq > 3 )
+  {
+    for( int k=0; k<nfrac; k++ )
+    {
+      for( int i=0; i<n; i++ )  qbk[k][no[i]] = 0.0;
+    }
+
+    return;
+  }
+
+  // friction velocity and mean grain diameter of the active layer ----------------------
+
+  double Ubseff[kBlock], dm[kBlock];
+
+  GetUtau( n, Us, H, dhds, Ubseff, project );
+
+  for( int i=0; i<n; i++ )
+  {
+    dm[i] = 0.0;
+    for( int k=0; k<nfrac; k++ )  dm[i] += fb[k][no[i]] * dk[k];
+  }
+
+  int koch = loadeq != 2  &&  phir > 0.001  &&  isFS(slope,kSLOPE_Shields);
+
+  // -------------------------------------------------------------------------------------
+
+  for( int k=0; k<nfrac; k++ )
+  {
+    double d       = dk[k];
+    double thetacr = 0.047;
+
+    if( loadeq != 2 )
+    {
+      double Dst = d * pow( rr*g/vk/vk, 0.3333 );
+      thetacr    = Shields_crit( Dst, 0.0 );
+    }
+
+    for( int i=0; i<n; i++ )
+    {
+      double thcr = thetacr;
+
+      if( hiding != 0.0  &&  dm[i] > 0.0 )              // hiding and exposure
+      {
+        if( fastMath )  thcr *= FastExp( -hiding * FastLog(d/dm[i]) );
+        else            thcr *= pow( d/dm[i], -hiding );
+      }
+
+      if( koch )                                        // KOCH, 1980
+      {
+        thcr *= 1.0 + dzds[i]/phir;
+        if( thcr < 0.01 )  thcr = 0.01;
+      }
+
+      double theta = Ubseff[i]*Ubseff[i] / rr / g / d;
+
+      double q = 0.0;
+
+      if( theta > thcr )
+      {
+        double x = 1.0 - thcr/theta;
+
+        if( fastMath )  q = 8.0 * Ubseff[i] * d * theta * (x * sqrt(x));
+        else            q = 8.0 * Ubseff[i] * d * theta * pow( x, 1.5 );
+      }
+
+      if( isFS(slope, kSLOPE_Qbe) )                     // gravitation effect by WANG
+      {
+        double f = 1.0 - alfaSlope * dzds[i];
+
+        if( f >= 0.0 )  q *= f;
+        else            q  = 0.0;
+      }
+
+      q *= fb[k][no[i]];
+
+      qbk[k][no[i]] = q;
+      qbe[i]       += q;
+    }
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------
+// InitFrac: initialize the composition of the active layer with the substrate
+//           composition pk; the composition is kept from one cycle to the next
+// ---------------------------------------------------------------------------------------
+
+void SED::InitFrac( int np )
+{
+  if( npfb == np )  return;
+
+  double sum = 0.0;
+  for( int k=0; k<nfrac; k++ )  sum += pk[k];
+
+  if( sum <= 0.0 )
+    REPORT::rpt.Error( kParameterFault, "no composition of grain fractions - SED::InitFrac(1)" );
+
+  for( int k=0; k<nfrac; k++ )
+  {
+    pk[k] /= sum;
+
+    delete[] fb[k];
+
+    fb[k] = new double[np];
+    if( !fb[k] )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - SED::InitFrac(2)" );
+
+    for( int n=0; n<np; n++ )  fb[k][n] = pk[k];
+  }
+
+  npfb = np;
+}
+
+
+// ---------------------------------------------------------------------------------------
+// Composition: change of the active layer composition (HIRANO, 1971) from the change of
+//              bed elevation dzdt*dt and the changes dzdtk[k]*dt of grain fractions; the
+//              material exchanged with the substrate has the composition of the active
+//              layer in case of deposition and the substrate composition pk for erosion
+// ---------------------------------------------------------------------------------------
+
+void SED::Composition( PROJECT* project,
+                       MODEL*   model,
+                       double*  dzdt,
+                       double** dzdtk,
+                       double   dt )
+{
+  GRID* rg = model->region;
+  int   np = rg->Getnp();
+
+  double la = La;
+  if( la <= 0.0 )  la = 2.0 * d90;
+
+  for( int n=0; n<np; n++ )
+  {
+    NODE* nd = rg->Getnode(n);
+    int   no = nd->Getno();
+
+    if( !isFS(nd->flag, NODE::kCornNode) )  continue;
+
+    double dz  = dzdt[no] * dt;
+    double sum = 0.0;
+
+    for( int k=0; k<nfrac; k++ )
+    {
+      double fI = (dz < 0.0)?  pk[k] : fb[k][no];
+
+      fb[k][no] += (dzdtk[k][no] * dt  -  fI * dz) / la;
+
+      if( fb[k][no] < 0.0 )  fb[k][no] = 0.0;
+
+      sum += fb[k][no];
+    }
+
+    for( int k=0; k<nfrac; k++ )
+    {
+      if( sum > 0.0 )  fb[k][no] /= sum;
+      else             fb[k][no]  = pk[k];
+    }
+  }
+
+  // interpolate composition at midside nodes --------------------------------------------
+  for( int e=0; e<rg->Getne(); e++ )
+  {
+    ELEM* el = rg->Getelem(e);
+
+    int ncn = el->Getncn();
+    int nnd = el->Getnnd();
+
+    for( int i=ncn; i<nnd; i++ )
+    {
+      int il, ir;
+      el->GetQShape()->getCornerNodes( i, &il, &ir );
+
+      int nom = el->Getnode(i)->Getno();
+      int nol = el->Getnode(il)->Getno();
+      int nor = el->Getnode(ir)->Getno();
+
+      for( int k=0; k<nfrac; k++ )  fb[k][nom] = 0.5 * (fb[k][nol] + fb[k][nor]);
+    }
+  }
+}
+
+
 // ---------------------------------------------------------------------------------------
 // Vanrijn: van Rijn formula
 // ---------------------------------------------------------------------------------------
@@ -954,6 +1364,85 @@ double SED::GetLs( double   Us,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// GetLs: nonequilibrium parameter Ls for n nodes (the same as SED::GetLs() per node)
+// ---------------------------------------------------------------------------------------
+
+void SED::GetLs( int      n,
+                 double*  Us,
+                 double*  H,
+                 double*  Ls,
+                 PROJECT* project )
+{
+  double g   = project->g;
+  double rho = project->rho;
+  double vk  = project->vk;
+  double rr  = rhob/rho - 1.0;
+
+  double Dst     = 0.0;
+  double thetacr = 0.0;
+  double Ubscr   = 0.0;
+  double Ubseff[kBlock];
+
+  if( lsType == 4  ||  lsType == 5 )
+  {
+    Dst     = d50 * pow( rr*g/vk/vk, 0.3333 );
+    thetacr = Shields_crit( Dst, 0.0 );
+    Ubscr   = sqrt( thetacr*rr*g*d50 );
+
+    GetUtau( n, Us, H, NULL, Ubseff, project );
+  }
+
+  switch( lsType )
+  {
+    case 2:
+      for( int i=0; i<n; i++ )  Ls[i] = minLs;
+      break;
+
+    case 3:
+      for( int i=0; i<n; i++ )  Ls[i] = factLs * d50;
+      break;
+
+    case 4:                                       // van Rijn
+      {
+        double c = 3.0 * d50 * pow( Dst, 0.6 );
+
+        for( int i=0; i<n; i++ )
+        {
+          Ls[i] = 0.0;
+
+          if( Ubseff[i] > Ubscr  &&  Ubscr > 1.0e-6 )
+          {
+            double tstage = ( Ubseff[i]*Ubseff[i] - Ubscr*Ubscr ) / Ubscr / Ubscr;
+
+            if( fastMath )  Ls[i] = c * FastExp( 0.9 * FastLog(tstage) );
+            else            Ls[i] = c * pow( tstage, 0.9 );
+          }
+        }
+      }
+      break;
+
+    case 5:                                       // Phillips and Sutherland
+      for( int i=0; i<n; i++ )
+      {
+        double theta = Ubseff[i] * Ubseff[i] / rr / g / d50;
+
+        Ls[i] = alfaLs * ( theta - thetacr ) * d50;
+      }
+      break;
+
+    default:
+      for( int i=0; i<n; i++ )  Ls[i] = 0.0;
+      break;
+  }
+
+  for( int i=0; i<n; i++ )
+  {
+    if( Ls[i] < minLs )  Ls[i] = minLs;
+  }
+}
+
+
 // ---------------------------------------------------------------------------------------
 // Ls_vanrijn: compute Ls by formula of van Rijn
 // ---------------------------------------------------------------------------------------
@@ -1095,6 +1584,56 @@ double SED::GetUtau( double   Us,
 }
 
 
+// ---------------------------------------------------------------------------------------
+//  GetUtau:  friction velocity for n nodes (dhds = NULL: no slope correction)
+// ---------------------------------------------------------------------------------------
+
+void SED::GetUtau( int      n,
+                   double*  Us,
+                   double*  H,
+                   double*  dhds,
+                   double*  Utau,
+                   PROJECT* project )
+{
+  double hmin  = project->hmin;
+  double grav  = project->g;
+  double kappa = project->kappa;
+
+  for( int i=0; i<n; i++ )
+  {
+    double h = H[i];
+    if( h < hmin )  h = hmin;                     // Utau = 0 below
+
+    // compute sqrt(cf), cf = friction coefficient; roughness height ks = d90
+    double sqrt_cf;
+
+    if( fastMath )  sqrt_cf = kappa / FastLog( 12.0 * h / d90 );
+    else            sqrt_cf = kappa / log( 12.0 * h / d90 );
+
+    Utau[i] = sqrt_cf * Us[i];
+
+    if( H[i] < hmin  ||  Us[i] <= 1.0e-6 )  Utau[i] = 0.0;
+  }
+
+  if( dhds  &&  isFS(slope,kSLOPE_Tau) )          // NAKAGAWA et al. (1980)
+  {
+    for( int i=0; i<n; i++ )
+    {
+      if( H[i] >= hmin  &&  Us[i] > 1.0e-6  &&  dhds[i] > 0.0 )
+      {
+        double Fro = Us[i]*Us[i]/grav/H[i];       // Froude number
+        double df  = 1.0 - betaSlope*dhds[i]/Fro;
+
+        if( df > 2.0 )  df = 2.0;
+
+        if( df > 0.0 )  Utau[i] *= sqrt( df );
+        else            Utau[i]  = 0.0;
+      }
+    }
+  }
+}
+
+
 // ---------------------------------------------------------------------------------------
 // compute mass balance Vtot for element
 // ---------------------------------------------------------------------------------------
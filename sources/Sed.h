@@ -49,6 +49,13 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  31.10.2005    sc    first implementation / first concept
+//  19.10.2026    ag    morphological factor, bed load sub steps per flow step and
+//                      skipping of flow cycles for small bed changes (morFac, subSteps,
+//                      skipFlow, sumDz)
+//  19.10.2026    ag    transport capacity computed for blocks of kBlock nodes (structure
+//                      of arrays); fast log/exp approximations (fastMath, $SED_LOADEQ)
+//  19.10.2026    ag    grain fractions of bed load with hiding/exposure and composition
+//                      of an active layer (nfrac, dk, pk, qbk, fb)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -76,8 +83,21 @@ class SED
     double* dzmx;             // maximum of bed slope in flow direction (+)
     double* dhds;             // change of flow depth in flow direction (+)
 
+    enum { kMaxFrac = 8 };    // maximum number of grain fractions
+
+    double* qbk[kMaxFrac];    // transport capacity and rate of grain fractions
+    double* fb[kMaxFrac];     // composition of the active layer at nodes
+    int     npfb;             // number of nodes in fb[]
+
   public:
-    int    nfrac;             // number of sediment fractions (place holder)
+    int    nfrac;             // number of grain fractions of bed load
+                              // 1 = uniform sediment with d50
+
+    double dk[kMaxFrac];      // grain diameter of fractions
+    double pk[kMaxFrac];      // composition of substrate and inflowing bed load
+    double hiding;            // exponent of hiding/exposure function
+    double La;                // thickness of active layer (0: La = 2*d90)
+    int    frac;              // fraction of the actual solution (-1: total load)
 
     double rhob;              // density of grain
 
@@ -98,12 +118,20 @@ class SED
                               // to determine the morphological time step
     int    zb_init;
 
+    double morFac;            // morphological factor: bed change per flow time step
+    int    subSteps;          // number of bed load/Exner sub steps per flow step
+    int    subStep;           // actual sub step (0, 1, ..., subSteps-1)
+    double skipFlow;          // skip flow cycles while the bed change since the last
+                              // flow solution is less than skipFlow * maxDz (0 = off)
+    double sumDz;             // bed change since the last flow solution (< 0: none)
+
     int    exnerEq;           // exner equation to solve for bed evolution
                               // 1 = algebraic solve: (qb-qbe)/Ls
                               // 2 = numerical solve: div(qb) by finite volumes
                               // 3 = numerical solve: div(qb) by finite elements
 
     int    loadeq;            // equation for equilibrium bed load
+    int    fastMath;          // use approximations of log() and pow() in Capacity()
 
     int    lsType;            // equation for non-equilibrium parameter Ls
     double minLs;             // minimum value for loading parameter Ls
@@ -129,6 +157,8 @@ class SED
       kVanRijn=1,  kMeyerPM=2
     };
 
+    enum { kBlock = 128 };    // number of nodes processed at once in Capacity()
+
   public:
     SED()
     {
@@ -142,6 +172,22 @@ class SED
       dzmx       = NULL;
       dhds       = NULL;
 
+      for( int k=0; k<kMaxFrac; k++ )
+      {
+        qbk[k]   = NULL;
+        fb[k]    = NULL;
+
+        dk[k]    = 0.0;
+        pk[k]    = 0.0;
+      }
+
+      npfb       = 0;
+
+      nfrac      = 1;
+      hiding     = 0.0;
+      La         = 0.0;
+      frac       = -1;
+
       rhob       = 2500.0;
 
       M          = 0.0;
@@ -155,6 +201,7 @@ class SED
       phir       = tan( PI/6.0 );        // tan(30�)
 
       loadeq     = 1;
+      fastMath   = false;
 
       lsType     = 1;
       minLs      = 1.00;
@@ -171,6 +218,12 @@ class SED
 
       zb_init    = false;
 
+      morFac     = 1.0;
+      subSteps   = 1;
+      subStep    = 0;
+      skipFlow   = 0.0;
+      sumDz      = -1.0;
+
       exnerEq    = 3;
 
       alfaSlope  = 1.00;
@@ -179,6 +232,11 @@ class SED
       deltaSlope = 0.25;
     };
 
+    ~SED()
+    {
+      for( int k=0; k<kMaxFrac; k++ )  delete[] fb[k];
+    };
+
     int Getinit()  { return isinit; };
 
     //////////////////////////////////////////////////////////////////////////////////////
@@ -204,18 +262,33 @@ class SED
     double Meyerpm( double Us, double H, double dzds, double dhds, PROJECT* p );
     double Vanrijn( double Us, double H, double dzds, double dhds, PROJECT* p );
 
+    void   Equilib( int n, double* Us, double* H, double* dzds, double* dhds,
+                    double* qbe, PROJECT* p );
+    void   Meyerpm( int n, double* Us, double* H, double* dzds, double* dhds,
+                    double* qbe, PROJECT* p );
+
+    // -----------------------------------------------------------------------------------
+    // grain fractions: transport capacity and composition of the active layer
+    void   InitFrac( int np );
+    void   EquilibFrac( int n, int* no, double* Us, double* H, double* dzds,
+                        double* dhds, double* qbe, PROJECT* p );
+    void   Composition( PROJECT* p, MODEL* m, double* dzdt, double** dzdtk, double dt );
+
     // -----------------------------------------------------------------------------------
     // determine values for nonequilibrium parameter Ls
     double GetLs( double Us, double H, PROJECT* p );
     double Ls_vanrijn( double Us, double H, PROJECT* p );
     double Ls_phillips( double Us, double H, PROJECT* p );
 
+    void   GetLs( int n, double* Us, double* H, double* Ls, PROJECT* p );
+
     // -----------------------------------------------------------------------------------
     // determine the critical value of Shields parameter
     double Shields_crit( double Dst, double dzdx );
 
     // -----------------------------------------------------------------------------------
     double GetUtau( double Us, double H, double dzds, PROJECT* p );
+    void   GetUtau( int n, double* Us, double* H, double* dhds, double* Utau, PROJECT* p );
 
     // -----------------------------------------------------------------------------------
     double Balance( ELEM* elem, int shape, double* etaQb, double V[kMaxNodes2D],
@@ -40,6 +40,7 @@
 #include "Memory.h"
 #include "Elem.h"
 #include "Node.h"
+#include "Grid.h"
 #include "Model.h"
 #include "Project.h"
 
@@ -93,6 +94,18 @@ void EQS::SetEqno( MODEL*   model,
   }
 
 
+  // stable equation numbers over drying and rewetting ----------------------------------
+
+  if( stable )
+  {
+    SetStableEqno( model, neqcn, neqmn, neqel, fix );
+    return;
+  }
+
+  stableNeq = 0;
+  nmask     = 0;
+
+
   // initialization ----------------------------------------------------------------------
 
   for( int i=0; i<dfcn; i++ )
@@ -225,6 +238,214 @@ void EQS::SetEqno( MODEL*   model,
 }
 
 
+// ---------------------------------------------------------------------------------------
+// Stable equation numbers: all nodes and elements of the region are numbered once in the
+// order of their last occurence (as in ResetEqOrder), so that the index matrix is set up
+// only once and kept over drying and rewetting. Equations of dry nodes and elements and
+// of fixed values are masked: GetEqno() returns -1 for them, and they are kept as
+// identity rows with zero right hand side in the equation system (CRSMAT::Assemble).
+// The last occurence of equations is not determined; the frontal solvers do not
+// support stable equation numbers.
+// ---------------------------------------------------------------------------------------
+
+void EQS::SetStableEqno( MODEL*   model,
+                         int      neqcn,
+                         int      neqmn,
+                         int      neqel,
+                         unsigned
+                         int*     fix )
+{
+  GRID* rg   = model->region;
+  int   rgnp = rg->Getnp();
+  int   rgne = rg->Getne();
+
+
+  // number the equations of all region nodes and elements -------------------------------
+
+  if( stableNeq == 0  ||  stableDf[0] != neqcn
+                      ||  stableDf[1] != neqmn
+                      ||  stableDf[2] != neqel )
+  {
+    if( !stableNode  &&  dfcn > 0 )
+    {
+      stableNode = new int* [ dfcn ];
+      int* buf   = new int  [ dfcn * rgnp ];
+
+      if( !stableNode || !buf )
+        REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS::SetStableEqno(1)" );
+
+      for( int i=0; i<dfcn; i++ )  stableNode[i] = buf + i * rgnp;
+    }
+
+    if( !stableElem  &&  dfel > 0 )
+    {
+      stableElem = new int* [ dfel ];
+      int* buf   = new int  [ dfel * rgne ];
+
+      if( !stableElem || !buf )
+        REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS::SetStableEqno(2)" );
+
+      for( int i=0; i<dfel; i++ )  stableElem[i] = buf + i * rgne;
+    }
+
+    for( int i=0; i<dfcn; i++ )
+    {
+      for( int j=0; j<rgnp; j++ )  stableNode[i][j] = -1;
+    }
+
+    for( int i=0; i<dfel; i++ )
+    {
+      for( int j=0; j<rgne; j++ )  stableElem[i][j] = -1;
+    }
+
+    int* count = (int*) MEMORY::memo.Array( rgnp );
+
+    for( int n=0; n<rgnp; n++ )  count[n] = 0;
+
+    for( int e=0; e<rgne; e++ )
+    {
+      ELEM* el  = rg->Getelem(e);
+      int   nnd = el->Getnnd();
+
+      for( int i=0; i<nnd; i++ )  count[el->nd[i]->Getno()]++;
+    }
+
+    stableNeq = 0;
+
+    for( int e=0; e<rgne; e++ )
+    {
+      ELEM* el  = rg->Getelem(e);
+      int   nnd = el->Getnnd();
+
+      for( int i=0; i<nnd; i++ )
+      {
+        NODE* nd = el->nd[i];
+        int   no = nd->Getno();
+
+        if( --count[no] > 0 )  continue;
+
+        int neqnd = isFS(nd->flag, NODE::kCornNode)?  neqcn : neqmn;
+
+        for( int j=0; j<neqnd; j++ )  stableNode[j][no] = stableNeq++;
+      }
+
+      if( !isFS(el->flag, ELEM::kBound) )
+      {
+        for( int j=0; j<neqel; j++ )  stableElem[j][el->Getno()] = stableNeq++;
+      }
+    }
+
+    MEMORY::memo.Detach( count );
+
+    stableDf[0] = neqcn;
+    stableDf[1] = neqmn;
+    stableDf[2] = neqel;
+
+    delete[] mask;
+    mask = new int [ stableNeq ];
+
+    if( !mask )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS::SetStableEqno(3)" );
+
+    initStructure = true;
+  }
+
+
+  // equation numbers of the actual model (cf. SetEqno) ----------------------------------
+
+  neq    = stableNeq;
+  neq_up = neq;
+  neq_dn = neq;
+
+  for( int i=0; i<neq; i++ )  mask[i] = true;
+
+  for( int i=0; i<dfcn; i++ )
+  {
+    for( int j=0; j<rgnp; j++ )  nodeEqno[i][j] = -1;
+  }
+
+  for( int i=0; i<dfel; i++ )
+  {
+    for( int j=0; j<rgne; j++ )  elemEqno[i][j] = -1;
+  }
+
+  for( int n=0; n<model->np; n++ )
+  {
+    NODE* nd = model->node[n];
+    int   no = nd->Getno();
+
+    int neqnd = isFS(nd->flag, NODE::kCornNode)?  neqcn : neqmn;
+
+    for( int j=0; j<neqnd; j++ )
+    {
+      if( isFS(nd->bc.kind, fix[j]) )  continue;
+
+      int eqno = stableNode[j][no];
+
+      if( eqno < 0 )
+        REPORT::rpt.Error( kUnexpectedFault, "%s - EQS::SetStableEqno(4)",
+                           "node without stable equation number" );
+
+      nodeEqno[j][no] = eqno;
+      mask[eqno]      = false;
+    }
+  }
+
+  for( int e=0; e<model->ne; e++ )
+  {
+    ELEM* el = model->elem[e];
+
+    if( isFS(el->flag, ELEM::kBound) )  continue;
+
+    for( int j=0; j<neqel; j++ )
+    {
+      int eqno = stableElem[j][el->Getno()];
+
+      elemEqno[j][el->Getno()] = eqno;
+      mask[eqno]               = false;
+    }
+  }
+
+
+  // list of masked equations (identity rows) --------------------------------------------
+
+  nmask = 0;
+
+  for( int i=0; i<neq; i++ )
+  {
+    if( mask[i] )  mask[nmask++] = i;
+  }
+
+  REPORT::rpt.Message( 3, "\n%-25s%s %d (%d masked)\n", " (EQS::SetStableEqno)",
+                          "number of equations is", neq, nmask );
+
+
+  // set up list of node pointers for equation numbers -----------------------------------
+
+  if( !eqnoNode || !eqid )
+  {
+    eqid     = new int  [kSimDF * rgnp];
+    eqnoNode = new NODE*[kSimDF * rgnp];
+    if( !eqid || !eqnoNode )
+      REPORT::rpt.Error( kMemoryFault, "can not allocate memory - EQS::SetStableEqno(5)" );
+  }
+
+  for( int n=0; n<model->np; n++ )
+  {
+    for( int j=0; j<dfcn; j++ )
+    {
+      int e = nodeEqno[j][model->node[n]->Getno()];
+
+      if( e >= 0 )
+      {
+        eqid[e]     = j;
+        eqnoNode[e] = model->node[n];
+      }
+    }
+  }
+}
+
+
 // ---------------------------------------------------------------------------------------
 // determine last occurence of equations during element assembling
 
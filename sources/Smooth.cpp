@@ -132,7 +132,11 @@ void GRID::SmoothS( int passes )
 }
 
 
-void GRID::SmoothKD( int passes )
+// ---------------------------------------------------------------------------------------
+// With mark != NULL smoothing is restricted to the marked nodes and the elements
+// connected to them; the values of unmarked nodes are left unchanged.
+
+void GRID::SmoothKD( int passes, char* mark )
 {
   int*    Kcounter = (int*)    MEMORY::memo.Array_nd( np );
   int*    Dcounter = (int*)    MEMORY::memo.Array_nd( np );
@@ -150,6 +154,14 @@ void GRID::SmoothKD( int passes )
       {
         int nnd = el->Getnnd();
 
+        if( mark )
+        {
+          int j;
+          for( j=0; j<nnd; j++ )  if( mark[el->nd[j]->Getno()] )  break;
+
+          if( j == nnd )  continue;
+        }
+
         double K = 0.0;
         double D = 0.0;
 
@@ -178,6 +190,8 @@ void GRID::SmoothKD( int passes )
 
         for( int j=0; j<nnd; j++ )
         {
+          if( mark  &&  !mark[el->nd[j]->Getno()] )  continue;
+
           BCON* bc = &el->nd[j]->bc;
 
           if( !isFS(bc->kind, BCON::kFixK) )
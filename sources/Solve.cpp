@@ -103,6 +103,8 @@ int EQS::Solve( MODEL*   model,
     case kFrontm:
       if( !X )  REPORT::rpt.Error( "solver not supported - EQS::Solve(2)" );
 
+      assemble = true;                            // the matrix is factorized in Direct()
+
       if( this->initStructure )
       {
         KillCrsm();
@@ -184,6 +186,15 @@ int EQS::Solve( MODEL*   model,
 
       if( this->initStructure )
       {
+        // a preconditioner kept by the caller belongs to the previous structure
+        if( *precon )
+        {
+          delete *precon;
+          *precon = NULL;
+        }
+
+        assemble = true;
+
         KillCrsm();
 
         REPORT::rpt.Screen( 3, "\n ... setting index matrix\n" );
@@ -199,10 +210,19 @@ int EQS::Solve( MODEL*   model,
       // ---------------------------------------------------------------------------------
       // assemble equation system
 
-      if( assemble )
+      // without request to assemble (assemble = false) the matrix of the previous
+      // solution is kept and only the residual is assembled: the matrix serves as
+      // preconditioner of Jacobian-free Newton-Krylov iterations or is solved with a
+      // further right hand side (e.g. grain fractions in EQS_BL2D and EQS_DZ)
+
+      if( assemble )  crsm->Init();               // initialize the matrix
+
+      crsm->Assemble( this, B, model, project, assemble, auxiliary );
+
+      if( jfnk )
       {
-        crsm->Init();                             // initialize the matrix
-        crsm->AssembleEqs_im( this, B, model, project );
+        jfnkForce = (double*) MEMORY::memo.Array_eq( neq );
+        for( int i=0; i<neq; i++ )  jfnkForce[i] = B[i];
       }
 
       ////////////////////////////////////////////////////////////////////////////////////
@@ -251,7 +271,41 @@ int EQS::Solve( MODEL*   model,
 #     endif
       ////////////////////////////////////////////////////////////////////////////////////
 
-      scale = crsm->ScaleL2Norm( B, &project->subdom );
+      if( jfnk )
+      {
+        // the matrix is not scaled, since it may serve as preconditioner for more
+        // than one solution; the products are scaled in MulVecFD()
+        double bb = 0.0;
+        for( int i=0; i<crsm->m_neq_dn; i++ )  bb += B[i] * B[i];
+
+#       ifdef _MPI_
+        bb = project->subdom.Mpi_sum( bb );
+#       endif
+
+        scale     = sqrt( bb );
+        jfnkScale = 1.0;
+
+        if( scale > kZero )
+        {
+          jfnkScale = scale;
+          for( int i=0; i<neq; i++ )  B[i] /= scale;
+        }
+      }
+
+      else if( assemble )
+      {
+        scale = crsm->ScaleL2Norm( B, &project->subdom );
+
+        crsmScale = 1.0;
+        if( fabs(scale) > kZero )  crsmScale = scale;
+      }
+
+      else
+      {
+        // the kept matrix has been scaled already; B is scaled with the same factor
+        scale = crsmScale;
+        for( int i=0; i<neq; i++ )  B[i] /= scale;
+      }
 
       if( !(*precon) )
       {
@@ -300,20 +354,57 @@ int EQS::Solve( MODEL*   model,
       }
 
       // ---------------------------------------------------------------------------------
+      // a non-zero initial guess X: relax the convergence criterion, which is related to
+      // the initial residual, to the accuracy reached with a zero initial guess
+      // with a forcing term the criterion follows the nonlinear convergence (Forcing)
 
-      if( !slv->Iterate( project, crsm, B, X, *precon ) )
       {
-        err = true;
+        double maxDiff = slv->maxDiff;
+        double ratio   = WarmStart( project, B, X );
 
-        // reset the right hand side to a not assembled vector ---------------------------
-#       ifdef _MPI_
-        memcpy( B, rhs, neq );
-        for( int i=0; i<neq; i++ )  B[i] /= scale;
-#       endif
+        if( slv->forcing  &&  eta > maxDiff )
+        {
+          slv->maxDiff = eta;
+
+          REPORT::rpt.Message( 3, "\n%-25s%s %10.4le\n", " (EQS::Solve)",
+                                  "forcing term: eta =", eta );
+        }
+
+        if( ratio * slv->maxDiff >= 1.0 )
+        {
+          REPORT::rpt.Message( 3, "\n%-25s%s\n", " (EQS::Solve)",
+                                  "initial guess is converged" );
+
+          slv->iterCountCG = 0;
+        }
+
+        else
+        {
+          slv->maxDiff *= ratio;
+
+          if( !slv->Iterate( project, crsm, B, X, *precon ) )
+          {
+            err = true;
+
+            // reset the right hand side to a not assembled vector -----------------------
+#           ifdef _MPI_
+            memcpy( B, rhs, neq );
+            for( int i=0; i<neq; i++ )  B[i] /= scale;
+#           endif
+          }
+        }
+
+        slv->maxDiff = maxDiff;
       }
 
       MEMORY::memo.Detach( rhs );
 
+      if( jfnkForce )
+      {
+        MEMORY::memo.Detach( jfnkForce );
+        jfnkForce = NULL;
+      }
+
       iterCountCG += slv->iterCountCG;
       break;
 
@@ -361,9 +452,9 @@ int EQS::Solve( MODEL*   model,
   }
 
 
-  // release memory for preconditioner ---------------------------------------------------
+  // release memory for preconditioner, unless the caller keeps it with a handle --------
 
-  if( *precon )
+  if( precon == &pre  &&  *precon )
   {
     delete *precon;
     *precon = NULL;
@@ -372,3 +463,120 @@ int EQS::Solve( MODEL*   model,
 
   return err;
 }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Scale a non-zero initial guess X by a = (B,AX)/(AX,AX), which minimizes the initial
+// residual ||B - a*AX||. The ratio ||B|| / ||B - a*AX|| is returned; it is 1.0 for a
+// zero initial guess or if the guess does not reduce the residual (X is reset to zero).
+
+double EQS::WarmStart( PROJECT* project, double* B, double* X )
+{
+  int neq    = crsm->m_neq;
+  int neq_dn = crsm->m_neq_dn;
+
+  double xx = 0.0;
+
+  for( int i=0; i<neq_dn; i++ )  xx += X[i] * X[i];
+
+# ifdef _MPI_
+  xx = project->subdom.Mpi_sum( xx );
+# endif
+
+  if( xx <= 0.0 )  return 1.0;
+
+
+  // -------------------------------------------------------------------------------------
+
+  double* AX = (double*) MEMORY::memo.Array_eq( neq );
+
+  crsm->MulVec( X, AX, project, this );
+
+  double bb = 0.0;
+  double ba = 0.0;
+  double aa = 0.0;
+
+  for( int i=0; i<neq_dn; i++ )
+  {
+    bb += B[i]  * B[i];
+    ba += B[i]  * AX[i];
+    aa += AX[i] * AX[i];
+  }
+
+# ifdef _MPI_
+  bb = project->subdom.Mpi_sum( bb );
+  ba = project->subdom.Mpi_sum( ba );
+  aa = project->subdom.Mpi_sum( aa );
+# endif
+
+  double a = 0.0;
+  if( aa > 0.0 )  a = ba / aa;
+
+  if( a <= 0.0 )
+  {
+    for( int i=0; i<neq; i++ )  X[i] = 0.0;
+
+    MEMORY::memo.Detach( AX );
+    return 1.0;
+  }
+
+  double rr = 0.0;
+
+  for( int i=0; i<neq_dn; i++ )
+  {
+    double r = B[i] - a * AX[i];
+    rr += r * r;
+  }
+
+# ifdef _MPI_
+  rr = project->subdom.Mpi_sum( rr );
+# endif
+
+  for( int i=0; i<neq; i++ )  X[i] *= a;
+
+  MEMORY::memo.Detach( AX );
+
+  REPORT::rpt.Message( 3, "\n%-25s%s %10.4le %s %10.4le\n", " (EQS::WarmStart)",
+                          "scaled initial guess: a =", a, "| ||r||/||B|| =", sqrt(rr/bb) );
+
+  if( rr <= 0.0 )  return 1.0 / kEpsilon;
+
+  return sqrt( bb / rr );
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Forcing term of the inexact Newton iteration (Eisenstat-Walker, choice 2) with
+// gamma = 0.9 and alpha = 2. The argument norm is the nonlinear residual of the last
+// iteration, measured as maximum change scaled by the convergence criterion (Update).
+// A norm <= 0 starts a new iteration with the maximum forcing term solver->maxEta.
+// Safeguards: the previous eta is kept if it was large (0.9*eta^2 > 0.1) and eta is
+// not reduced below 0.5/norm to avoid oversolving close to nonlinear convergence.
+
+void EQS::Forcing( PROJECT* project, double norm )
+{
+  SOLVER* slv = project->actualSolver;
+
+  if( norm <= 0.0  ||  etaNorm <= 0.0 )
+  {
+    eta     = slv->maxEta;
+    etaNorm = norm;
+    return;
+  }
+
+  const double gamma = 0.9;
+
+  double ratio = norm / etaNorm;
+  double e     = gamma * ratio * ratio;
+  double prev  = gamma * eta * eta;
+
+  if( prev > 0.1  &&  prev > e )  e = prev;
+
+  if( 0.5 / norm > e )  e = 0.5 / norm;
+
+  if( e > slv->maxEta )   e = slv->maxEta;
+  if( e < slv->maxDiff )  e = slv->maxDiff;
+
+  eta     = e;
+  etaNorm = norm;
+}
@@ -65,6 +65,9 @@ SOLVER::SOLVER()
 
   mkyrl       = 10;
 
+  forcing     = 0;
+  maxEta      = 0.1;
+
   accuracy    = 1.0;
   iterCountCG = 0;
 };
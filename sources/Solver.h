@@ -49,6 +49,7 @@
 //    date              changes
 // ------------  ----  -----------------------------------------------------------------------------
 //  01.01.1992    sc    first implementation / first concept
+//  19.10.2026    ag    forcing term for inexact Newton iterations (Eisenstat-Walker)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -146,6 +147,10 @@ class SOLVER
 
     int     mkyrl;                 // dimension of krylov subspace
 
+    int     forcing;               // forcing term: (0) fixed maxDiff
+                                   //               (1) Eisenstat-Walker, choice 2
+    double  maxEta;                // maximum forcing term
+
     double  accuracy;              // accuracy of CG-Solver
     int     iterCountCG;           // total counter for CG iterations
 
@@ -52,6 +52,12 @@ TIMEINT::TIMEINT()
   thetaTurb = 0.5;
   thetaSedi = 0.5;
 
+  adapt        = false;
+  adaptCu      = 0.0;
+  adaptMinTime = 0.0;
+  adaptIter    = 0;
+  adaptInc     = 0.0;
+
   result = NULL;
   reset_statist = NULL;
 
@@ -84,11 +90,13 @@ TIMEINT::TIMEINT()
     kTM_PERIODIC_LINE,   "TM_PERIODIC_LINE",    // 17
     kTM_PERIODIC_NODE,   "TM_PERIODIC_NODE",    // 18
 
-    kTM_RESET_STATIST,   "TM_RESET_STATIST"     // 19
+    kTM_RESET_STATIST,   "TM_RESET_STATIST",    // 19
+
+    kTM_ADAPT,           "TM_ADAPT"             // 20
   };
 
   datkey = dk;
-  nkey   = 19;
+  nkey   = 20;
 
   set = false;
   startTime.Set( "0" );
@@ -726,6 +734,12 @@ void TIMEINT::Input_30900( ASCIIFILE* file )
         sscanf( textLine, "$TM_WEIGHT %lf %lf %lf", &thetaFlow, &thetaTurb, &thetaSedi );
         break;
 
+      // read parameters for adaptive sub steps ------------------------------------------
+      case kTM_ADAPT:
+        adapt = true;
+        sscanf( textLine, "$TM_ADAPT %lf %lf %d", &adaptCu, &adaptMinTime, &adaptIter );
+        break;
+
       // determine number of boundary sets -----------------------------------------------
       case kTM_STEP_NO:
         setsOfBcon++;
@@ -1265,6 +1279,18 @@ void TIMEINT::Input_30900( ASCIIFILE* file )
           "                   sediment:", thetaSedi );
   REPORT::rpt.Output( text, 2 );
 
+  if( adapt )
+  {
+    REPORT::rpt.Output( "\n", 2 );
+    REPORT::rpt.OutputLine1( 2 );
+
+    sprintf( text, "\n  %30s  %-9.3lf\n  %30s  %-9.3lf\n  %30s  %-4d\n",
+            "adaptive sub steps, max. Cu:", adaptCu,
+            "    minimum time increment:", adaptMinTime,
+            "     target NR iterations:", adaptIter );
+    REPORT::rpt.Output( text, 2 );
+  }
+
 
   // report time step numbers for output -------------------------------------------------
 
@@ -1592,6 +1618,12 @@ void TIMEINT::Input_40100( ASCIIFILE *file )
         sscanf( textLine, "$TM_WEIGHT %lf %lf %lf", &thetaFlow, &thetaTurb, &thetaSedi );
         break;
 
+      // read parameters for adaptive sub steps ------------------------------------------
+      case kTM_ADAPT:
+        adapt = true;
+        sscanf( textLine, "$TM_ADAPT %lf %lf %d", &adaptCu, &adaptMinTime, &adaptIter );
+        break;
+
       // determine number of boundary sets -----------------------------------------------
       case kTM_STEP_NO:
         setsOfBcon++;
@@ -1835,6 +1867,15 @@ void TIMEINT::Input_40100( ASCIIFILE *file )
           ||  !bconSet[i].bcLine[j].D  ||  !bconSet[i].bcLine[j].C
           ||  !bconSet[i].bcLine[j].Qb ||  !bconSet[i].bcLine[j].gct )
           REPORT::rpt.Error( "can not allocate memory (TIMEINT::Input_40100 #7)" );
+
+      // no gauge control, if not specified for an outlet (see PROJECT::ngauge)
+      for( int k=0; k<maxbcline[j]; k++ )
+      {
+        bconSet[i].bcLine[j].gct[k].node = 0;
+        bconSet[i].bcLine[j].gct[k].nocg = 0;
+        bconSet[i].bcLine[j].gct[k].So   = 0.0;
+        bconSet[i].bcLine[j].gct[k].dS   = 0.0;
+      }
     }
   }
 
@@ -2554,6 +2595,18 @@ void TIMEINT::Input_40100( ASCIIFILE *file )
           "                   sediment:", thetaSedi );
   REPORT::rpt.Output( text, 2 );
 
+  if( adapt )
+  {
+    REPORT::rpt.Output( "\n", 2 );
+    REPORT::rpt.OutputLine1( 2 );
+
+    sprintf( text, "\n  %30s  %-9.3lf\n  %30s  %-9.3lf\n  %30s  %-4d\n",
+            "adaptive sub steps, max. Cu:", adaptCu,
+            "    minimum time increment:", adaptMinTime,
+            "     target NR iterations:", adaptIter );
+    REPORT::rpt.Output( text, 2 );
+  }
+
 
   // report time step numbers for output -------------------------------------------------
 
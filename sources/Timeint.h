@@ -52,6 +52,7 @@
 //  29.03.2010    sc    Rismo-Version 4.01.00, new keywords: kTM_NODE, kTM_LINE
 //                      class RELOC to ensure backward compatibility
 //  13.10.2012    sc    Rismo-Version 4.03.00, new keyword: kTM_STATIONARY
+//  19.10.2026    ag    new keyword: kTM_ADAPT (adaptive sub steps)
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -118,7 +119,7 @@ class TIMEINT
       kTM_SETTIME,       kTM_STEP_NO,       kTM_CYCLE,       kTM_STATIONARY,
       kTM_TURBULENCE,    kTM_DISPERSION,    kTM_MAXITER,     kTM_SOLVER,
       kTM_BOUND_NODE,    kTM_BOUND_LINE,    kTM_NODE,        kTM_LINE,
-      kTM_PERIODIC_NODE, kTM_PERIODIC_LINE, kTM_RESET_STATIST
+      kTM_PERIODIC_NODE, kTM_PERIODIC_LINE, kTM_RESET_STATIST, kTM_ADAPT
     };
 
     int      release;
@@ -153,6 +154,13 @@ class TIMEINT
     double   thetaTurb;            // time weighting, turbulence equation
     double   thetaSedi;            // time weighting, sediment equation
 
+                                   // adaptive sub steps ---------------------------------
+    int      adapt;                // adaptive time increment within the time steps
+    double   adaptCu;              // target Courant number (0: no limit)
+    double   adaptMinTime;         // minimum time increment [s]
+    int      adaptIter;            // target number of Newton iterations (0: no limit)
+    double   adaptInc;             // time increment for the next sub step [s]
+
     int*     result;               // array of time steps for output
 
     int      nPeriodicNode;        // number of node pairs with periodic boundary condition
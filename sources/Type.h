@@ -71,6 +71,9 @@
 //  13.10.2012    sc    roughness of walls (log law) is no longer set by material zones
 //                      thus rtype[2] and rcoef[2] are now rtype and rcoef
 //                      wall roughnees may be applied by slip flow boundary conditions
+//  19.10.2026    ag    optional warm start of Colebrook-White's iteration (cw)
+//  19.10.2026    ag    tabulated drag coefficient of non-submerged vegetation (DRAGTAB)
+//  19.10.2026    ag    drag table optional at runtime ($DRAGTABLE), checked inside of cells
 //
 // /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -89,6 +92,40 @@
 class ASCIIFILE;
 
 
+// ======================================================================================
+// Table of the drag coefficient cWR of non-submerged vegetation (TYPE::lindner) on a
+// grid of logarithmically spaced velocities and flow depths. Cells, where bilinear
+// interpolation misses the error bound TYPE::dragTol at the centre or one of the four
+// quarter points of the cell, are flagged to be computed with the exact iteration.
+
+class DRAGTAB
+{
+  public:
+    int     rate;              // grid points per decade
+    int     nu, nh;            // number of grid points: velocity, flow depth
+    double  lu0, lh0;          // log10 of smallest velocity and flow depth
+    double* cWR;               // drag coefficients at grid points (-1.0 = failed)
+    char*   exact;             // flags of cells: use the exact iteration
+    double  key[5];            // parameters of the table: ka, vk, g, d90, error bound
+
+  public:
+    DRAGTAB();
+    ~DRAGTAB();
+
+    void Alloc( int rate );
+    void Free();
+
+    // ----------------------------------------------------------------------------------
+    // interpolate cWR for <n> pairs (va,ha); cWR[i] = -1.0 if out of range or the
+    // cell is flagged for the exact iteration
+    void Interpolate( int n, double* va, double* ha, double* cWR );
+
+  private:
+    DRAGTAB( const DRAGTAB& );
+    DRAGTAB& operator =( const DRAGTAB& );
+};
+
+
 class TYPE
 {
   // ====================================================================================
@@ -117,6 +154,10 @@ class TYPE
     static int    release;      // release of roughness-file
 
   public:
+    enum        { kBatch = 64 };  // maximum number of nodes in batched bottom()
+
+    static double dragTol;      // error bound of the drag table (0.0: no table)
+
     enum        { kCOWI = 2,    // Colebrook-White's law
                   kNIKU = 3,    // Nikuradse's law
                   kCHEZ = 4,    // Chezy's law
@@ -179,6 +220,8 @@ class TYPE
 
     double betaSf;             // dispersion coefficient beta (secondary flow)
 
+    DRAGTAB drag;              // table of cWR for non-submerged vegetation dp[0]/sp[0]
+
   // ====================================================================================
   //                               M E T H O D E N
   // ====================================================================================
@@ -337,10 +380,21 @@ class TYPE
     //             double vk    = kinematic viscosity
     //             double dw    = wall distance
     //             double g     = gravity acceleration ( = 9.81 )
+    //             double* cw   = optional start value of 1/sqrt(cf) for the iteration
+    //                            of Colebrook-White's law; on return the solution
     double bottom( double Us, double h, double ka, double vk, double g,
-                   double rho, double rhob, double d50, double d90 );
+                   double rho, double rhob, double d50, double d90, double* cw =NULL );
+
+    // batched version of bottom() for <n> <= kBatch nodes: cf[i] on return
+    void   bottom( int n, double* Us, double* h, double ka, double vk, double g,
+                   double rho, double rhob, double d50, double d90,
+                   double* cw, double* cf );
+
+    // friction coefficient for grain roughness with form roughness kd (dunes), kr (ripples)
+    double grain( double Us, double h, double ka, double vk, double g,
+                  double d90, double kd, double kr, double* cw =NULL );
     double friction( int rtype, double rc, double Us, double h,
-                     double ka, double vk, double g );
+                     double ka, double vk, double g, double* cw =NULL );
     void Dune( double Us, double H,
                double ka, double vk, double g, double rho,
                double rhob, double d50, double d90,
@@ -362,6 +416,16 @@ class TYPE
     double lindner( double dp, double sp, double va, double ha,
                     double cf, double vk, double g );
     void   statisLindner();
+
+    // ----------------------------------------------------------------------------------
+    // The method vegetation() returns the same as lindner( dp[0], sp[0], ... ) with the
+    // drag coefficient interpolated from the table <drag>, which is built on first use
+    // by dragBuild(), if an error bound dragTol > 0.0 is given ($DRAGTABLE). The exact
+    // iteration is used without table, outside of the table and in flagged cells.
+    double vegetation( double va, double ha, double cf, double vk, double g );
+    void   vegetation( int n, double* va, double* ha, double* cf, double* cp,
+                       double vk, double g );
+    void   dragBuild( double ka, double vk, double g, double d90 );
     double dragCoeff( double, double, double );
     int    cubeEquation( double, double, double, double, double [3] );
 
@@ -55,6 +55,8 @@ void GRID::VeloGrad( PROJECT* project, double* dUdx, double* dUdy,
 
   double* A = (double*) MEMORY::memo.Array_nd( rgnp );
 
+  for( int n=0; n<rgnp; n++ )  A[n] = 0.0;
+
 
   // loop over elements ------------------------------------------------------------------
 